@@ -1,4 +1,8 @@
 {
+    "variables": {
+        "simd_fft%": 1,
+        "avx2%": 0,
+    },
     "targets": [
         {
             "target_name": "vita",
@@ -75,6 +79,10 @@
                         "libraries": ["-lsndfile"],
                         "cflags_cc": ["-march=native"],
                         "defines": ["LINUX=1"],
+                        "conditions": [
+                            ["simd_fft==1", {"defines": ["VITAL_SIMD_FFT=1"]}],
+                            ["avx2==1", {"defines": ["VITAL_AVX2=1"], "cflags_cc": ["-mavx2"]}],
+                        ],
                         "sources": [
                             "headless/JuceLibraryCode/include_juce_audio_basics.cpp",
                             "headless/JuceLibraryCode/include_juce_audio_formats.cpp",
@@ -3,8 +3,14 @@
 // 1. Load the native addon using node-gyp-build (works with both regular builds and prebuildify)
 const vita = require('node-gyp-build')(__dirname);
 
-// 2. Load batch renderer
+// 2. Load batch renderer and the streaming render wrapper
 const VitaBatchRenderer = require('./batch-renderer');
+const renderStream = require('./render-stream');
+
+vita.Synth.prototype.renderStream = function (note, velocity, noteDuration, renderDuration, options) {
+  return renderStream(this, note, velocity, noteDuration, renderDuration, options);
+};
+vita.Synth.prototype.render_stream = vita.Synth.prototype.renderStream;
 
 // 3. Build the object you want to export
 const exportsObject = {
@@ -15,10 +21,22 @@ const exportsObject = {
   // Python-style function names (snake_case)
   get_modulation_sources: vita.get_modulation_sources,
   get_modulation_destinations: vita.get_modulation_destinations,
+  get_wavetable_cache_stats: vita.get_wavetable_cache_stats,
+  set_wavetable_cache_size: vita.set_wavetable_cache_size,
+  clear_wavetable_cache: vita.clear_wavetable_cache,
+  preset_json_to_binary: vita.preset_json_to_binary,
+  preset_binary_to_json: vita.preset_binary_to_json,
+  create_synths: vita.create_synths,
   
   // JavaScript-style function names (camelCase)
   getModulationSources: vita.getModulationSources,
   getModulationDestinations: vita.getModulationDestinations,
+  getWavetableCacheStats: vita.getWavetableCacheStats,
+  setWavetableCacheSize: vita.setWavetableCacheSize,
+  clearWavetableCache: vita.clearWavetableCache,
+  presetJsonToBinary: vita.presetJsonToBinary,
+  presetBinaryToJson: vita.presetBinaryToJson,
+  createSynths: vita.createSynths,
   
   // Batch rendering
   BatchRenderer: VitaBatchRenderer
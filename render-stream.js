@@ -0,0 +1,24 @@
+const { Readable } = require('stream');
+
+/**
+ * Streams a render as a Readable of Buffers holding interleaved stereo float samples.
+ * The native side renders ahead on its own thread but only keeps a few chunks waiting,
+ * so the render pauses while the consumer is busy and memory doesn't grow with duration.
+ */
+function renderStream(synth, note, velocity, noteDuration, renderDuration, options) {
+    const source = synth._openRenderStream(note, velocity, noteDuration, renderDuration, options);
+
+    return new Readable({
+        // Each read() already waits for a whole chunk, so don't queue any more on the JS side.
+        highWaterMark: 0,
+        read() {
+            source.read().then((chunk) => this.push(chunk), (error) => this.destroy(error));
+        },
+        destroy(error, callback) {
+            source.destroy();
+            callback(error);
+        }
+    });
+}
+
+module.exports = renderStream;
@@ -0,0 +1,127 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "batch_renderer.h"
+#include "synth_base.h"
+
+#include <chrono>
+
+BatchRenderer::BatchRenderer(int num_threads) : queued_(0), remaining_(0), shutting_down_(false) {
+  num_threads = std::max(1, num_threads);
+  for (int i = 0; i < num_threads; ++i)
+    threads_.emplace_back(&BatchRenderer::workerLoop, this);
+}
+
+BatchRenderer::~BatchRenderer() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shutting_down_ = true;
+  }
+  work_available_.notify_all();
+
+  for (std::thread& thread : threads_)
+    thread.join();
+}
+
+void BatchRenderer::renderJobs(const std::vector<Job>& jobs, ResultCallback callback) {
+  if (jobs.empty())
+    return;
+
+  std::lock_guard<std::mutex> batch_lock(batch_mutex_);
+  callback_ = std::move(callback);
+  remaining_ = static_cast<int>(jobs.size());
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.enqueue_bulk(jobs.begin(), jobs.size());
+    queued_ += static_cast<int>(jobs.size());
+  }
+  work_available_.notify_all();
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  batch_done_.wait(lock, [this] { return remaining_ == 0; });
+  callback_ = nullptr;
+}
+
+void BatchRenderer::workerLoop() {
+  // Each thread builds its engine on first use and keeps it for the life of the pool.
+  std::unique_ptr<HeadlessSynth> synth;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      work_available_.wait(lock, [this] { return shutting_down_ || queued_ > 0; });
+      if (shutting_down_)
+        return;
+    }
+
+    Job job;
+    while (queue_.try_dequeue(job)) {
+      queued_--;
+      if (synth == nullptr)
+        synth = std::make_unique<HeadlessSynth>();
+
+      Result result = renderJob(*synth, job);
+      callback_(result);
+
+      if (--remaining_ == 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        batch_done_.notify_all();
+      }
+    }
+  }
+}
+
+BatchRenderer::Result BatchRenderer::renderJob(HeadlessSynth& synth, const Job& job) {
+  auto start = std::chrono::steady_clock::now();
+
+  Result result;
+  result.id = job.id;
+
+  try {
+    if (job.preset_path.empty())
+      synth.loadInitPreset();
+    else if (!synth.loadFromFile(File(job.preset_path), result.error)) {
+      if (result.error.empty())
+        result.error = "Failed to load preset: " + job.preset_path;
+      return result;
+    }
+
+    if (job.output_path.empty()) {
+      result.audio = synth.renderAudioToNumpy(job.note, job.velocity, job.note_duration, job.render_duration,
+                                              job.options);
+      result.success = true;
+    }
+    else {
+      File output_file(job.output_path);
+      output_file.getParentDirectory().createDirectory();
+      result.success = synth.renderAudioToFile2(job.output_path, job.note, job.velocity,
+                                                job.note_duration, job.render_duration, job.options);
+      if (result.success)
+        result.file_size = output_file.getSize();
+      else
+        result.error = "Failed to render audio";
+    }
+  }
+  catch (const std::exception& e) {
+    result.success = false;
+    result.error = e.what();
+  }
+
+  std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  result.duration_ms = elapsed.count();
+  return result;
+}
@@ -0,0 +1,87 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "concurrentqueue/concurrentqueue.h"
+#include "audio_buffer.h"
+#include "render_options.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class HeadlessSynth;
+
+// Renders jobs across a fixed pool of threads, each owning its own HeadlessSynth.
+// Idle threads pull jobs from a shared lock-free queue so slow presets don't hold up the rest.
+class BatchRenderer {
+  public:
+    struct Job {
+      int id = 0;
+      std::string preset_path;
+      std::string output_path;
+      int note = 60;
+      float velocity = 0.7f;
+      float note_duration = 2.0f;
+      float render_duration = 4.0f;
+      RenderOptions options;
+    };
+
+    struct Result {
+      int id = 0;
+      bool success = false;
+      std::string error;
+      double duration_ms = 0.0;
+      int64 file_size = 0;
+      // Only filled in when the job has no output path. The callback takes ownership of the data.
+      VitalAudioBuffer audio = {};
+    };
+
+    typedef std::function<void(Result&)> ResultCallback;
+
+    BatchRenderer(int num_threads);
+    ~BatchRenderer();
+
+    int getNumThreads() const { return static_cast<int>(threads_.size()); }
+
+    // Renders all _jobs_ and blocks until they're finished.
+    // _callback_ is called from the render threads as each job completes.
+    void renderJobs(const std::vector<Job>& jobs, ResultCallback callback);
+
+  private:
+    void workerLoop();
+    Result renderJob(HeadlessSynth& synth, const Job& job);
+
+    std::vector<std::thread> threads_;
+    moodycamel::ConcurrentQueue<Job> queue_;
+    std::atomic<int> queued_;
+    std::atomic<int> remaining_;
+    bool shutting_down_;
+
+    ResultCallback callback_;
+    std::mutex batch_mutex_;
+    std::mutex mutex_;
+    std::condition_variable work_available_;
+    std::condition_variable batch_done_;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BatchRenderer)
+};
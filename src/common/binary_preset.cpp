@@ -0,0 +1,353 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "binary_preset.h"
+#include "audio_block.h"
+#include "synth_parameters.h"
+
+#include <algorithm>
+
+namespace {
+  const char kMagic[] = { 'V', 'T', 'L', 'B' };
+
+  enum Flags {
+    kHasModulations = 1,
+  };
+
+  struct Block {
+    std::string pointer;
+    int element_size;
+    MemoryBlock data;
+  };
+
+  // Audio fields stored as base64 in the json. Wavetable frames are floats, the rest 16 bit pcm.
+  int blockElementSize(const std::string& key) {
+    if (key == "wave_data")
+      return sizeof(float);
+    if (key == "audio_file" || key == "samples" || key == "samples_stereo")
+      return sizeof(int16_t);
+    return 0;
+  }
+
+  std::string escapePointerToken(const std::string& token) {
+    std::string escaped;
+    for (char c : token) {
+      if (c == '~')
+        escaped += "~0";
+      else if (c == '/')
+        escaped += "~1";
+      else
+        escaped += c;
+    }
+    return escaped;
+  }
+
+  // Stable across platforms, unlike std::hash.
+  uint32_t parameterLayoutHash() {
+    static const uint32_t hash = []() {
+      uint32_t result = 2166136261u;
+      for (int i = 0; i < vital::Parameters::getNumParameters(); ++i) {
+        const std::string& name = vital::Parameters::getDetails(i)->name;
+        for (size_t c = 0; c <= name.size(); ++c) {
+          result ^= static_cast<uint8_t>(c < name.size() ? name[c] : 0);
+          result *= 16777619u;
+        }
+      }
+      return result;
+    }();
+    return hash;
+  }
+
+  int64 alignOffset(int64 offset) {
+    return (offset + BinaryPreset::kBlockAlignment - 1) / BinaryPreset::kBlockAlignment * BinaryPreset::kBlockAlignment;
+  }
+
+  void extractBlocks(json& value, const std::string& pointer, std::vector<Block>& blocks) {
+    if (value.is_array()) {
+      for (size_t i = 0; i < value.size(); ++i)
+        extractBlocks(value[i], pointer + "/" + std::to_string(i), blocks);
+      return;
+    }
+
+    if (!value.is_object())
+      return;
+
+    for (auto it = value.begin(); it != value.end(); ++it) {
+      std::string child = pointer + "/" + escapePointerToken(it.key());
+      int element_size = blockElementSize(it.key());
+      if (element_size && it.value().is_string()) {
+        std::string encoded = it.value();
+        MemoryOutputStream decoded;
+        // Only take data that encodes back to the exact same text so the round trip stays lossless.
+        if (Base64::convertFromBase64(decoded, encoded) && decoded.getDataSize() % element_size == 0 &&
+            Base64::toBase64(decoded.getData(), decoded.getDataSize()).toStdString() == encoded) {
+          blocks.push_back({ child, element_size, decoded.getMemoryBlock() });
+          it.value() = nullptr;
+          continue;
+        }
+      }
+      extractBlocks(it.value(), child, blocks);
+    }
+  }
+
+  bool isModulationRecord(const json& modulation) {
+    if (!modulation.is_object() || !modulation.count("source") || !modulation.count("destination"))
+      return false;
+    if (!modulation["source"].is_string() || !modulation["destination"].is_string())
+      return false;
+    return modulation.size() == 2 || (modulation.size() == 3 && modulation.count("line_mapping"));
+  }
+
+  void writeString(MemoryOutputStream& stream, const std::string& value) {
+    stream.writeInt(static_cast<int>(value.size()));
+    stream.write(value.data(), value.size());
+  }
+
+  void writeCbor(MemoryOutputStream& stream, const json& value) {
+    std::vector<uint8_t> cbor = json::to_cbor(value);
+    stream.writeInt(static_cast<int>(cbor.size()));
+    stream.write(cbor.data(), cbor.size());
+  }
+
+  class Reader {
+    public:
+      Reader(const void* data, size_t size) : data_(static_cast<const uint8_t*>(data)), size_(size), position_(0) { }
+
+      bool has(size_t bytes) const { return bytes <= size_ - position_; }
+
+      const uint8_t* take(size_t bytes) {
+        if (!has(bytes))
+          throw std::runtime_error("Binary preset is truncated.");
+        const uint8_t* result = data_ + position_;
+        position_ += bytes;
+        return result;
+      }
+
+      int readInt() { return static_cast<int>(ByteOrder::littleEndianInt(take(sizeof(int)))); }
+      int64 readInt64() { return static_cast<int64>(ByteOrder::littleEndianInt64(take(sizeof(int64)))); }
+
+      float readFloat() {
+        uint32_t bits = ByteOrder::littleEndianInt(take(sizeof(float)));
+        float value;
+        memcpy(&value, &bits, sizeof(float));
+        return value;
+      }
+
+      std::string readString() {
+        int length = readInt();
+        if (length < 0)
+          throw std::runtime_error("Binary preset is corrupted.");
+        return std::string(reinterpret_cast<const char*>(take(length)), length);
+      }
+
+      json readCbor() {
+        int length = readInt();
+        if (length < 0)
+          throw std::runtime_error("Binary preset is corrupted.");
+        const uint8_t* bytes = take(length);
+        return json::from_cbor(bytes, bytes + length);
+      }
+
+      const uint8_t* data() const { return data_; }
+      size_t size() const { return size_; }
+
+    private:
+      const uint8_t* data_;
+      size_t size_;
+      size_t position_;
+  };
+} // namespace
+
+bool BinaryPreset::isBinaryPreset(const void* data, size_t size) {
+  return size >= kHeaderSize && memcmp(data, kMagic, sizeof(kMagic)) == 0;
+}
+
+bool BinaryPreset::isBinaryPreset(const File& file) {
+  FileInputStream stream(file);
+  char magic[sizeof(kMagic)];
+  return stream.openedOk() && stream.read(magic, sizeof(magic)) == sizeof(magic) &&
+         memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+}
+
+void BinaryPreset::jsonToBinary(const json& state, MemoryBlock& output) {
+  json rest = state;
+  int num_parameters = vital::Parameters::getNumParameters();
+  std::vector<float> controls(num_parameters, 0.0f);
+  std::vector<uint8_t> controls_set((num_parameters + 7) / 8, 0);
+  int flags = 0;
+  json modulations = json::array();
+
+  if (rest.count("settings") && rest["settings"].is_object()) {
+    json& settings = rest["settings"];
+    for (int i = 0; i < num_parameters; ++i) {
+      const std::string& name = vital::Parameters::getDetails(i)->name;
+      auto found = settings.find(name);
+      if (found == settings.end() || !found->is_number_float())
+        continue;
+
+      // Values that don't fit a float exactly stay in the json section.
+      double value = *found;
+      if (static_cast<double>(static_cast<float>(value)) != value)
+        continue;
+
+      controls[i] = static_cast<float>(value);
+      controls_set[i / 8] |= 1 << (i % 8);
+      settings.erase(found);
+    }
+
+    auto found = settings.find("modulations");
+    if (found != settings.end() && found->is_array() &&
+        std::all_of(found->begin(), found->end(), isModulationRecord)) {
+      modulations = *found;
+      settings.erase(found);
+      flags |= kHasModulations;
+    }
+  }
+
+  std::vector<Block> blocks;
+  extractBlocks(rest, "", blocks);
+
+  output.reset();
+  MemoryOutputStream stream(output, false);
+  stream.write(kMagic, sizeof(kMagic));
+  stream.writeInt(kFormatVersion);
+  stream.writeInt(num_parameters);
+  stream.writeInt(static_cast<int>(parameterLayoutHash()));
+  stream.writeInt(flags);
+  stream.writeInt(static_cast<int>(modulations.size()));
+  stream.writeInt(static_cast<int>(blocks.size()));
+  stream.writeInt(0);
+
+  for (float control : controls)
+    stream.writeFloat(control);
+  stream.write(controls_set.data(), controls_set.size());
+
+  for (const json& modulation : modulations) {
+    writeString(stream, modulation["source"]);
+    writeString(stream, modulation["destination"]);
+    if (modulation.count("line_mapping"))
+      writeCbor(stream, modulation["line_mapping"]);
+    else
+      stream.writeInt(0);
+  }
+
+  writeCbor(stream, rest);
+
+  int64 table_size = 0;
+  for (const Block& block : blocks)
+    table_size += 3 * sizeof(int) + block.pointer.size() + 2 * sizeof(int64);
+
+  int64 offset = alignOffset(stream.getPosition() + table_size);
+  for (const Block& block : blocks) {
+    writeString(stream, block.pointer);
+    stream.writeInt(block.element_size);
+    stream.writeInt(0);
+    stream.writeInt64(offset);
+    stream.writeInt64(block.data.getSize());
+    offset = alignOffset(offset + block.data.getSize());
+  }
+
+  for (const Block& block : blocks) {
+    stream.writeRepeatedByte(0, alignOffset(stream.getPosition()) - stream.getPosition());
+    stream.write(block.data.getData(), block.data.getSize());
+  }
+  stream.flush();
+}
+
+bool BinaryPreset::binaryToJson(const void* data, size_t size, json& state, std::string& error,
+                                bool reference_blocks) {
+  if (!isBinaryPreset(data, size)) {
+    error = "Not a binary preset.";
+    return false;
+  }
+
+  try {
+    Reader reader(data, size);
+    reader.take(sizeof(kMagic));
+    int version = reader.readInt();
+    int num_parameters = reader.readInt();
+    uint32_t layout_hash = static_cast<uint32_t>(reader.readInt());
+    int flags = reader.readInt();
+    int num_modulations = reader.readInt();
+    int num_blocks = reader.readInt();
+    reader.readInt();
+
+    if (version > kFormatVersion) {
+      error = "Binary preset was created with a newer version.";
+      return false;
+    }
+    if (num_parameters != vital::Parameters::getNumParameters() || layout_hash != parameterLayoutHash()) {
+      error = "Binary preset was written with a different parameter layout. Convert it through json instead.";
+      return false;
+    }
+
+    std::vector<float> controls(num_parameters);
+    for (float& control : controls)
+      control = reader.readFloat();
+    const uint8_t* controls_set = reader.take((num_parameters + 7) / 8);
+
+    json modulations = json::array();
+    for (int i = 0; i < num_modulations; ++i) {
+      json modulation;
+      modulation["source"] = reader.readString();
+      modulation["destination"] = reader.readString();
+      int mapping_size = reader.readInt();
+      if (mapping_size) {
+        const uint8_t* bytes = reader.take(mapping_size);
+        modulation["line_mapping"] = json::from_cbor(bytes, bytes + mapping_size);
+      }
+      modulations.push_back(modulation);
+    }
+
+    state = reader.readCbor();
+
+    for (int i = 0; i < num_blocks; ++i) {
+      std::string pointer = reader.readString();
+      reader.readInt();
+      reader.readInt();
+      int64 offset = reader.readInt64();
+      int64 block_size = reader.readInt64();
+      if (offset < 0 || block_size < 0 || offset + block_size > static_cast<int64>(size)) {
+        error = "Binary preset is corrupted.";
+        return false;
+      }
+
+      json& field = state[json::json_pointer(pointer)];
+      if (reference_blocks)
+        field = vital::audio_block::reference(reader.data() + offset, block_size);
+      else
+        field = Base64::toBase64(reader.data() + offset, block_size).toStdString();
+    }
+
+    bool has_controls = std::any_of(controls_set, controls_set + (num_parameters + 7) / 8,
+                                    [](uint8_t bits) { return bits != 0; });
+    if (has_controls || (flags & kHasModulations)) {
+      json& settings = state["settings"];
+      for (int i = 0; i < num_parameters; ++i) {
+        if (controls_set[i / 8] & (1 << (i % 8)))
+          settings[vital::Parameters::getDetails(i)->name] = controls[i];
+      }
+      if (flags & kHasModulations)
+        settings["modulations"] = modulations;
+    }
+  }
+  catch (const std::exception& e) {
+    error = "Binary preset is corrupted.";
+    return false;
+  }
+
+  return true;
+}
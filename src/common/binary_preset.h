@@ -0,0 +1,52 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "json/json.h"
+
+#include <string>
+
+using json = nlohmann::json;
+
+// Compact binary form of a preset's json state. Lossless in both directions.
+//
+// Layout, little endian:
+//   header          magic "VTLB", format version, table sizes
+//   controls        one float per parameter in Parameters index order, then a bitmap of which are set
+//   modulations     source, destination and CBOR line mapping per connection
+//   json            everything else as CBOR, with audio fields left null
+//   block table     json pointer and byte range of every audio field
+//   blocks          raw float or 16 bit pcm data, each 16 byte aligned so the file can be mapped
+class BinaryPreset {
+  public:
+    static constexpr int kFormatVersion = 1;
+    static constexpr int kHeaderSize = 32;
+    static constexpr int kBlockAlignment = 16;
+
+    static bool isBinaryPreset(const void* data, size_t size);
+    static bool isBinaryPreset(const File& file);
+
+    static void jsonToBinary(const json& state, MemoryBlock& output);
+    // With _reference_blocks_ audio fields point into _data_ instead of holding base64,
+    // so _state_ can only be loaded while _data_ is alive. See vital::audio_block.
+    static bool binaryToJson(const void* data, size_t size, json& state, std::string& error,
+                             bool reference_blocks = false);
+
+  private:
+    BinaryPreset() = delete;
+};
@@ -0,0 +1,162 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "feature_extractor.h"
+#include "fourier_transform.h"
+
+namespace {
+  float hzToMel(float hz) {
+    return 2595.0f * log10f(1.0f + hz / 700.0f);
+  }
+
+  float melToHz(float mel) {
+    return 700.0f * (powf(10.0f, mel / 2595.0f) - 1.0f);
+  }
+}
+
+FeatureExtractor::FeatureExtractor(const FeatureOptions& options, int sample_rate) :
+    options_(options), sample_rate_(sample_rate), skip_samples_(0) {
+  int fft_size = options_.fft_size;
+  if (options_.spectrogram || options_.mel) {
+    int bits = 0;
+    while ((1 << bits) < fft_size)
+      bits++;
+
+    transform_ = std::make_unique<vital::FourierTransform>(bits);
+    fft_data_.resize(2 * fft_size);
+    power_.resize(getNumBins());
+    window_.resize(fft_size);
+    for (int i = 0; i < fft_size; ++i)
+      window_[i] = 0.5f - 0.5f * cosf(vital::kPi * 2.0f * i / fft_size);
+  }
+
+  if (options_.mel)
+    initMelBands();
+
+  pending_.reserve(fft_size);
+}
+
+FeatureExtractor::~FeatureExtractor() { }
+
+void FeatureExtractor::initMelBands() {
+  int num_bands = options_.mel_bands;
+  float max_mel = hzToMel(sample_rate_ / 2.0f);
+  std::vector<float> edges(num_bands + 2);
+  for (int i = 0; i < num_bands + 2; ++i)
+    edges[i] = melToHz(max_mel * i / (num_bands + 1));
+
+  float bin_hz = sample_rate_ / (1.0f * options_.fft_size);
+  mel_bands_.resize(num_bands);
+  for (int b = 0; b < num_bands; ++b) {
+    float low = edges[b];
+    float center = edges[b + 1];
+    float high = edges[b + 2];
+
+    MelBand& band = mel_bands_[b];
+    band.start = static_cast<int>(ceilf(low / bin_hz));
+    int end = std::min(static_cast<int>(high / bin_hz), getNumBins() - 1);
+    for (int i = band.start; i <= end; ++i) {
+      float hz = i * bin_hz;
+      float weight = hz <= center ? (hz - low) / (center - low) : (high - hz) / (high - center);
+      band.weights.push_back(std::max(weight, 0.0f));
+    }
+  }
+}
+
+void FeatureExtractor::process(const float* left, const float* right, int num_samples) {
+  int fft_size = options_.fft_size;
+  int hop_size = options_.hop_size;
+  for (int i = 0; i < num_samples; ++i) {
+    if (skip_samples_) {
+      skip_samples_--;
+      continue;
+    }
+
+    pending_.push_back(0.5f * (left[i] + right[i]));
+    if (pending_.size() < fft_size)
+      continue;
+
+    analyzeFrame(pending_.data());
+    if (hop_size < fft_size)
+      pending_.erase(pending_.begin(), pending_.begin() + hop_size);
+    else {
+      pending_.clear();
+      skip_samples_ = hop_size - fft_size;
+    }
+  }
+}
+
+void FeatureExtractor::finish() {
+  int remaining = static_cast<int>(pending_.size());
+  while (remaining > 0) {
+    pending_.resize(options_.fft_size, 0.0f);
+    analyzeFrame(pending_.data());
+
+    remaining -= options_.hop_size;
+    if (remaining > 0)
+      pending_.erase(pending_.begin(), pending_.begin() + options_.hop_size);
+    pending_.resize(std::max(remaining, 0));
+  }
+  skip_samples_ = 0;
+}
+
+void FeatureExtractor::analyzeFrame(const float* frame) {
+  int fft_size = options_.fft_size;
+  features_.num_frames++;
+
+  float total_squared = 0.0f;
+  for (int i = 0; i < fft_size; ++i)
+    total_squared += frame[i] * frame[i];
+  float rms = sqrtf(total_squared / fft_size);
+  if (options_.rms)
+    features_.rms.push_back(rms);
+
+  if (transform_) {
+    for (int i = 0; i < fft_size; ++i)
+      fft_data_[i] = frame[i] * window_[i];
+    std::fill(fft_data_.begin() + fft_size, fft_data_.end(), 0.0f);
+    transform_->transformRealForward(fft_data_.data());
+
+    int num_bins = getNumBins();
+    for (int i = 0; i < num_bins; ++i)
+      power_[i] = fft_data_[2 * i] * fft_data_[2 * i] + fft_data_[2 * i + 1] * fft_data_[2 * i + 1];
+
+    if (options_.spectrogram) {
+      for (int i = 0; i < num_bins; ++i)
+        features_.spectrogram.push_back(sqrtf(power_[i]));
+    }
+
+    for (const MelBand& band : mel_bands_) {
+      float total = 0.0f;
+      for (int i = 0; i < band.weights.size(); ++i)
+        total += band.weights[i] * power_[band.start + i];
+      features_.mel.push_back(total);
+    }
+  }
+
+  if (options_.pitch) {
+    float frequency = 0.0f;
+    if (rms >= kMinPitchRms) {
+      int min_period = static_cast<int>(sample_rate_ / options_.max_pitch);
+      int max_period = std::min(static_cast<int>(ceilf(sample_rate_ / options_.min_pitch)), fft_size / 2);
+      pitch_detector_.loadSignal(frame, fft_size);
+      float period = pitch_detector_.findPeriod(min_period, max_period);
+      if (period > 0.0f)
+        frequency = sample_rate_ / period;
+    }
+    features_.pitch.push_back(frequency);
+  }
+}
@@ -0,0 +1,82 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "pitch_detector.h"
+#include "render_options.h"
+
+#include <memory>
+#include <vector>
+
+namespace vital {
+  class FourierTransform;
+} // namespace vital
+
+// Computes the features in FeatureOptions from render output as it arrives, so a render can hand back
+// spectrograms, loudness and pitch without another pass over the audio.
+class FeatureExtractor {
+  public:
+    static constexpr float kMinPitchRms = 0.001f;
+
+    // Every feature's frames back to back. Spectrogram frames are getNumBins() values long and mel frames
+    // mel_bands values long.
+    struct Features {
+      int num_frames = 0;
+      std::vector<float> spectrogram;
+      std::vector<float> mel;
+      std::vector<float> rms;
+      std::vector<float> pitch;
+    };
+
+    FeatureExtractor(const FeatureOptions& options, int sample_rate);
+    ~FeatureExtractor();
+
+    // Takes the next _num_samples_ of each channel and analyzes every frame they complete.
+    void process(const float* left, const float* right, int num_samples);
+    // Analyzes the frames still open at the end of the render.
+    void finish();
+
+    const FeatureOptions& getOptions() const { return options_; }
+    int getSampleRate() const { return sample_rate_; }
+    int getNumBins() const { return options_.fft_size / 2 + 1; }
+    Features& getFeatures() { return features_; }
+
+  private:
+    struct MelBand {
+      int start = 0;
+      std::vector<float> weights;
+    };
+
+    void initMelBands();
+    void analyzeFrame(const float* frame);
+
+    FeatureOptions options_;
+    int sample_rate_;
+    std::unique_ptr<vital::FourierTransform> transform_;
+    std::vector<float> window_;
+    std::vector<float> fft_data_;
+    std::vector<float> power_;
+    std::vector<MelBand> mel_bands_;
+    PitchDetector pitch_detector_;
+
+    std::vector<float> pending_;
+    int skip_samples_;
+    Features features_;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FeatureExtractor)
+};
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "JuceHeader.h"
+#include "simd_fourier_transform.h"
 
 namespace vital {
   #if INTEL_IPP
@@ -62,6 +63,21 @@ namespace vital {
       JUCE_LEAK_DETECTOR(FourierTransform)
   };
 
+  #elif VITAL_SIMD_FFT
+
+  class FourierTransform {
+    public:
+      FourierTransform(int bits) : fft_(bits) { }
+
+      void transformRealForward(float* data) { fft_.transformRealForward(data); }
+      void transformRealInverse(float* data) { fft_.transformRealInverse(data); }
+
+    private:
+      SimdFourierTransform fft_;
+
+      JUCE_LEAK_DETECTOR(FourierTransform)
+  };
+
   #elif JUCE_MODULE_AVAILABLE_juce_dsp
 
   class FourierTransform {
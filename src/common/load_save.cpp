@@ -15,6 +15,7 @@
  */
 
 #include "load_save.h"
+#include "audio_block.h"
 #include "modulation_connection_processor.h"
 #include "sound_engine.h"
 #include "midi_manager.h"
@@ -22,6 +23,7 @@
 #include "synth_base.h"
 #include "synth_constants.h"
 #include "synth_oscillator.h"
+#include "wavetable_cache.h"
 
 #define QUOTE(x) #x
 #define STRINGIFY(x) QUOTE(x)
@@ -62,11 +64,11 @@ void LoadSave::convertBufferToPcm(json& data, const std::string& field) {
     return;
 
   MemoryOutputStream decoded;
-  std::string wave_data = data[field];
-  Base64::convertFromBase64(decoded, wave_data);
-  int size = static_cast<int>(decoded.getDataSize()) / sizeof(float);
+  size_t data_size = 0;
+  const void* wave_data = vital::audio_block::read(data[field], decoded, data_size);
+  int size = static_cast<int>(data_size / sizeof(float));
   std::unique_ptr<float[]> float_data = std::make_unique<float[]>(size);
-  memcpy(float_data.get(), decoded.getData(), size * sizeof(float));
+  memcpy(float_data.get(), wave_data, size * sizeof(float));
   std::unique_ptr<int16_t[]> pcm_data = std::make_unique<int16_t[]>(size);
   vital::utils::floatToPcmData(pcm_data.get(), float_data.get(), size);
 
@@ -79,11 +81,11 @@ void LoadSave::convertPcmToFloatBuffer(json& data, const std::string& field) {
     return;
 
   MemoryOutputStream decoded;
-  std::string wave_data = data[field];
-  Base64::convertFromBase64(decoded, wave_data);
-  int size = static_cast<int>(decoded.getDataSize()) / sizeof(int16_t);
+  size_t data_size = 0;
+  const void* wave_data = vital::audio_block::read(data[field], decoded, data_size);
+  int size = static_cast<int>(data_size / sizeof(int16_t));
   std::unique_ptr<int16_t[]> pcm_data = std::make_unique<int16_t[]>(size);
-  memcpy(pcm_data.get(), decoded.getData(), size * sizeof(int16_t));
+  memcpy(pcm_data.get(), wave_data, size * sizeof(int16_t));
   std::unique_ptr<float[]> float_data = std::make_unique<float[]>(size);
   vital::utils::pcmToFloatData(float_data.get(), pcm_data.get(), size);
 
@@ -205,11 +207,17 @@ void LoadSave::loadWavetables(SynthBase* synth, const json& wavetables) {
   if (synth->getWavetableCreator(0) == nullptr)
     return;
 
+  WavetableCache* cache = WavetableCache::getInstance();
   int i = 0;
   for (const json& wavetable : wavetables) {
     WavetableCreator* wavetable_creator = synth->getWavetableCreator(i);
-    wavetable_creator->jsonToState(wavetable);
-    wavetable_creator->render();
+    wavetable_creator->jsonToGroups(wavetable);
+
+    WavetableCache::Key key = WavetableCache::keyForJson(wavetable);
+    if (!cache->load(key, wavetable_creator->getWavetable())) {
+      wavetable_creator->render();
+      cache->store(key, wavetable_creator->getWavetable());
+    }
     i++;
   }
 }
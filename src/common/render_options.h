@@ -0,0 +1,124 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// Breakpoint curve for one control during an offline render.
+// Values are raw control values, linearly interpolated between the breakpoints and held past either end.
+struct AutomationLane {
+  std::string name;
+  std::vector<double> times;
+  std::vector<vital::mono_float> values;
+
+  vital::mono_float valueAt(double time) const {
+    auto upper = std::upper_bound(times.begin(), times.end(), time);
+    if (upper == times.begin())
+      return values.front();
+    if (upper == times.end())
+      return values.back();
+
+    size_t index = upper - times.begin();
+    double t = (time - times[index - 1]) / (times[index] - times[index - 1]);
+    return values[index - 1] + t * (values[index] - values[index - 1]);
+  }
+};
+
+// Analysis computed from the render as it's produced. Frame i covers fft_size samples of the mono mix
+// starting at sample i * hop_size, and frames running past the end are padded with silence.
+struct FeatureOptions {
+  static constexpr int kDefaultFftSize = 2048;
+  static constexpr int kDefaultHopSize = 512;
+  static constexpr int kDefaultMelBands = 128;
+  static constexpr int kMinFftSize = 64;
+  static constexpr int kMaxFftSize = 16384;
+  static constexpr float kDefaultMinPitch = 40.0f;
+  static constexpr float kDefaultMaxPitch = 2000.0f;
+
+  static bool isValidFftSize(int fft_size) {
+    return fft_size >= kMinFftSize && fft_size <= kMaxFftSize && (fft_size & (fft_size - 1)) == 0;
+  }
+
+  bool enabled() const { return spectrogram || mel || rms || pitch; }
+
+  // Magnitudes of the Hann windowed STFT, fft_size / 2 + 1 bins per frame.
+  bool spectrogram = false;
+  // Power in mel_bands triangular bands on the HTK mel scale, from 0 Hz to half the sample rate.
+  bool mel = false;
+  bool rms = false;
+  // Fundamental frequency in Hz from YIN, searched between min_pitch and max_pitch. 0 where the frame
+  // is silent or has no clear period.
+  bool pitch = false;
+  // Whether the render call still returns the audio along with the features.
+  bool audio = true;
+  int fft_size = kDefaultFftSize;
+  int hop_size = kDefaultHopSize;
+  int mel_bands = kDefaultMelBands;
+  float min_pitch = kDefaultMinPitch;
+  float max_pitch = kDefaultMaxPitch;
+};
+
+// Settings for the offline render calls on SynthBase.
+struct RenderOptions {
+  static constexpr int kDefaultSampleRate = 44100;
+  static constexpr int kDefaultBlockSize = 64;
+  static constexpr int kDefaultBitDepth = 16;
+  static constexpr int kMinSampleRate = 8000;
+  static constexpr int kMaxSampleRate = 192000;
+  static constexpr float kDefaultSilenceThresholdDb = -90.0f;
+  static constexpr float kDefaultSilenceHold = 0.05f;
+
+  static bool isValidSampleRate(int sample_rate) {
+    return sample_rate >= kMinSampleRate && sample_rate <= kMaxSampleRate;
+  }
+
+  static bool isValidBlockSize(int block_size) {
+    return block_size >= 1 && block_size <= vital::kMaxBufferSize;
+  }
+
+  // 32 bit files are written as IEEE float.
+  static bool isValidBitDepth(int bit_depth) {
+    return bit_depth == 16 || bit_depth == 24 || bit_depth == 32;
+  }
+
+  int numSamples(float seconds) const { return static_cast<int>(seconds * sample_rate); }
+
+  int sample_rate = kDefaultSampleRate;
+  int block_size = kDefaultBlockSize;
+  int bit_depth = kDefaultBitDepth;
+  // Runs this render in lean mode even if the synth isn't. See SynthBase::setLeanProcessing.
+  bool lean = false;
+  // Ends the render once every note is released, no voice is left and the output has stayed under
+  // silence_threshold_db for silence_hold seconds. The render duration becomes a hard cap.
+  bool stop_on_silence = false;
+  float silence_threshold_db = kDefaultSilenceThresholdDb;
+  float silence_hold = kDefaultSilenceHold;
+  // Runs each block's effects on a second thread while the voices render the next block. Renders that
+  // automate or modulate anything outside the voices fall back to serial processing.
+  bool pipelined = false;
+  // Restarts every random source in the engine from this seed before the render, so the same preset,
+  // notes and seed give the same output in any synth, thread or process.
+  bool seeded = false;
+  int seed = 0;
+  // Applied at the start of every processing block, so smaller blocks give finer curves.
+  std::vector<AutomationLane> automation;
+  FeatureOptions features;
+};
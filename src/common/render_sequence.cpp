@@ -0,0 +1,85 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "render_sequence.h"
+
+#include <algorithm>
+
+void RenderSequence::noteOn(int sample, int note, vital::mono_float velocity, int channel) {
+  RenderEvent event;
+  event.type = RenderEvent::kNoteOn;
+  event.sample = sample;
+  event.note = note;
+  event.value = velocity;
+  event.channel = channel;
+  events_.push_back(event);
+}
+
+void RenderSequence::noteOff(int sample, int note, vital::mono_float lift, int channel) {
+  RenderEvent event;
+  event.type = RenderEvent::kNoteOff;
+  event.sample = sample;
+  event.note = note;
+  event.value = lift;
+  event.channel = channel;
+  events_.push_back(event);
+}
+
+bool RenderSequence::loadMidiFile(const File& file, int sample_rate, std::string& error) {
+  FileInputStream stream(file);
+  if (!stream.openedOk()) {
+    error = "Couldn't open MIDI file: " + file.getFullPathName().toStdString();
+    return false;
+  }
+
+  MidiFile midi_file;
+  if (!midi_file.readFrom(stream)) {
+    error = "Invalid MIDI file: " + file.getFullPathName().toStdString();
+    return false;
+  }
+
+  midi_file.convertTimestampTicksToSeconds();
+  for (int t = 0; t < midi_file.getNumTracks(); ++t) {
+    const MidiMessageSequence* track = midi_file.getTrack(t);
+    for (const MidiMessageSequence::MidiEventHolder* holder : *track) {
+      const MidiMessage& message = holder->message;
+      if (message.isMetaEvent() || message.isSysEx())
+        continue;
+
+      RenderEvent event;
+      event.type = RenderEvent::kMidiMessage;
+      event.sample = static_cast<int>(std::round(message.getTimeStamp() * sample_rate));
+      event.channel = message.getChannel() - 1;
+      event.message = message;
+      events_.push_back(event);
+    }
+  }
+
+  return true;
+}
+
+void RenderSequence::sort() {
+  std::stable_sort(events_.begin(), events_.end(), [](const RenderEvent& a, const RenderEvent& b) {
+    return a.sample < b.sample;
+  });
+}
+
+int RenderSequence::lastSample() const {
+  int last = 0;
+  for (const RenderEvent& event : events_)
+    last = std::max(last, event.sample);
+  return last;
+}
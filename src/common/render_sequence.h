@@ -0,0 +1,73 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "common.h"
+
+#include <string>
+#include <vector>
+
+// A single timed event for SynthBase::renderSequence.
+// _sample_ is the absolute position from the start of the render.
+struct RenderEvent {
+  enum Type {
+    kNoteOn,
+    kNoteOff,
+    kPitchBend,
+    kModWheel,
+    kAftertouch,
+    kChannelPressure,
+    kMidiMessage,
+  };
+
+  Type type = kNoteOn;
+  int sample = 0;
+  int channel = 0;
+  int note = 0;
+  // Velocity for notes, -1 to 1 for pitch bend and 0 to 1 for everything else.
+  vital::mono_float value = 0.0f;
+  // Only used by kMidiMessage. These go through the MidiManager like live input.
+  MidiMessage message;
+};
+
+// Time ordered list of events to render in one pass.
+class RenderSequence {
+  public:
+    RenderSequence() = default;
+
+    void add(const RenderEvent& event) { events_.push_back(event); }
+    void noteOn(int sample, int note, vital::mono_float velocity, int channel = 0);
+    void noteOff(int sample, int note, vital::mono_float lift = 0.5f, int channel = 0);
+
+    // Reads every track of a Standard MIDI File, converting tempo mapped times to samples.
+    bool loadMidiFile(const File& file, int sample_rate, std::string& error);
+
+    // Stable sort so events at the same sample keep the order they were added in.
+    void sort();
+    void clear() { events_.clear(); }
+
+    const std::vector<RenderEvent>& events() const { return events_; }
+    size_t size() const { return events_.size(); }
+    bool empty() const { return events_.empty(); }
+    int lastSample() const;
+
+  private:
+    std::vector<RenderEvent> events_;
+
+    JUCE_LEAK_DETECTOR(RenderSequence)
+};
@@ -0,0 +1,91 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "render_stream.h"
+#include "synth_base.h"
+
+RenderStream::RenderStream(SynthBase* synth, const Request& request) :
+    synth_(synth), request_(request), finished_(false), cancelled_(false) {
+  request_.chunk_samples = std::max(1, request_.chunk_samples);
+  request_.max_chunks = std::max(1, request_.max_chunks);
+  thread_ = std::thread(&RenderStream::run, this);
+}
+
+RenderStream::~RenderStream() {
+  cancel();
+  thread_.join();
+}
+
+bool RenderStream::read(std::vector<float>& chunk) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  chunk_ready_.wait(lock, [this] { return cancelled_ || finished_ || !chunks_.empty(); });
+  if (cancelled_ || chunks_.empty())
+    return false;
+
+  chunk = std::move(chunks_.front());
+  chunks_.pop_front();
+  space_ready_.notify_one();
+  return true;
+}
+
+void RenderStream::cancel() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cancelled_ = true;
+    chunks_.clear();
+  }
+  space_ready_.notify_all();
+  chunk_ready_.notify_all();
+}
+
+std::string RenderStream::getError() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return error_;
+}
+
+void RenderStream::run() {
+  std::string error;
+  try {
+    synth_->renderAudioToStream(request_.note, request_.velocity, request_.note_duration, request_.render_duration,
+                                request_.chunk_samples, request_.options,
+                                [this](const float* data, int num_samples) { return push(data, num_samples); });
+  }
+  catch (const std::exception& e) {
+    error = e.what();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    finished_ = true;
+    error_ = error;
+  }
+  chunk_ready_.notify_all();
+}
+
+bool RenderStream::push(const float* data, int num_samples) {
+  std::vector<float> chunk(data, data + 2 * num_samples);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  space_ready_.wait(lock, [this] {
+    return cancelled_ || chunks_.size() < static_cast<size_t>(request_.max_chunks);
+  });
+  if (cancelled_)
+    return false;
+
+  chunks_.push_back(std::move(chunk));
+  chunk_ready_.notify_one();
+  return true;
+}
@@ -0,0 +1,80 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "render_options.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class SynthBase;
+
+// Renders one note on its own thread and queues the audio in fixed-size chunks for a reader on another
+// thread. Only a few chunks are queued at a time and the render waits for the reader when they're full,
+// so memory stays the same however long the render is and the first chunk is ready straight away.
+class RenderStream {
+  public:
+    static constexpr int kDefaultChunkSamples = 4096;
+    static constexpr int kDefaultMaxChunks = 4;
+
+    struct Request {
+      int note = 60;
+      float velocity = 0.7f;
+      float note_duration = 2.0f;
+      float render_duration = 4.0f;
+      int chunk_samples = kDefaultChunkSamples;
+      int max_chunks = kDefaultMaxChunks;
+      RenderOptions options;
+    };
+
+    // Starts rendering right away. _synth_ is locked until the render finishes or the stream is cancelled.
+    RenderStream(SynthBase* synth, const Request& request);
+    ~RenderStream();
+
+    // Waits for the next chunk and moves it into _chunk_ as interleaved stereo floats.
+    // Returns false once every chunk has been read, the render failed or the stream was cancelled.
+    bool read(std::vector<float>& chunk);
+
+    // Stops the render at the next chunk boundary, drops anything queued and wakes a waiting reader.
+    void cancel();
+
+    // Why the render stopped early, empty if it didn't fail.
+    std::string getError();
+
+  private:
+    void run();
+    bool push(const float* data, int num_samples);
+
+    SynthBase* synth_;
+    Request request_;
+
+    std::mutex mutex_;
+    std::condition_variable chunk_ready_;
+    std::condition_variable space_ready_;
+    std::deque<std::vector<float>> chunks_;
+    bool finished_;
+    bool cancelled_;
+    std::string error_;
+    std::thread thread_;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RenderStream)
+};
@@ -0,0 +1,334 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "common.h"
+
+#include <cmath>
+
+namespace vital {
+
+  // Real FFT computed as a half size complex FFT plus a split step, so a 2^bits real transform costs
+  // one 2^(bits - 1) complex transform. The complex part is a radix 2 Stockham FFT over split real and
+  // imaginary buffers: every stage reads and writes whole poly_floats and the output comes out in
+  // natural order, so there is no bit reversal pass. Layout and scaling match the other
+  // FourierTransform backends.
+  class SimdFourierTransform {
+    public:
+      static constexpr int kVectorSize = poly_float::kSize;
+      static constexpr int kMinBits = 2;
+
+      SimdFourierTransform(int bits) : size_(1 << bits), half_size_(size_ / 2), num_stages_(bits - 1),
+                                       num_vectors_(std::max(1, half_size_ / kVectorSize)) {
+        VITAL_ASSERT(bits >= kMinBits);
+
+        // Complex twiddles exp(-2 pi i k / half_size), stage twiddles index into this with stride s.
+        int num_twiddles = std::max(1, half_size_ / 2);
+        int num_twiddle_vectors = std::max(1, num_twiddles / kVectorSize);
+        twiddle_real_ = std::make_unique<poly_float[]>(num_twiddle_vectors);
+        twiddle_imag_ = std::make_unique<poly_float[]>(num_twiddle_vectors);
+        float* twiddle_real = (float*)twiddle_real_.get();
+        float* twiddle_imag = (float*)twiddle_imag_.get();
+        for (int i = 0; i < num_twiddles; ++i) {
+          double phase = -2.0 * kPi * i / half_size_;
+          twiddle_real[i] = std::cos(phase);
+          twiddle_imag[i] = std::sin(phase);
+        }
+
+        // Stages with a stride narrower than a vector need one twiddle per lane.
+        for (int stride = 2; stride < kVectorSize && stride < half_size_; stride *= 2) {
+          std::unique_ptr<poly_float[]> real = std::make_unique<poly_float[]>(num_twiddle_vectors);
+          std::unique_ptr<poly_float[]> imag = std::make_unique<poly_float[]>(num_twiddle_vectors);
+          float* lane_real = (float*)real.get();
+          float* lane_imag = (float*)imag.get();
+          for (int i = 0; i < num_twiddles; ++i) {
+            lane_real[i] = twiddle_real[(i / stride) * stride];
+            lane_imag[i] = twiddle_imag[(i / stride) * stride];
+          }
+          lane_twiddle_real_.push_back(std::move(real));
+          lane_twiddle_imag_.push_back(std::move(imag));
+        }
+
+        // Split step twiddles exp(-2 pi i k / size) for k up to a quarter of the size.
+        split_real_ = std::make_unique<float[]>(half_size_ / 2 + 1);
+        split_imag_ = std::make_unique<float[]>(half_size_ / 2 + 1);
+        for (int i = 0; i <= half_size_ / 2; ++i) {
+          double phase = -2.0 * kPi * i / size_;
+          split_real_[i] = std::cos(phase);
+          split_imag_[i] = std::sin(phase);
+        }
+      }
+
+      void transformRealForward(float* data) {
+        Buffers buffers = scratchBuffers();
+        float* real = (float*)buffers.real[0];
+        float* imag = (float*)buffers.imag[0];
+        for (int i = 0; i < half_size_; ++i) {
+          real[i] = data[2 * i];
+          imag[i] = data[2 * i + 1];
+        }
+
+        int result = transformComplex(buffers);
+        real = (float*)buffers.real[result];
+        imag = (float*)buffers.imag[result];
+
+        data[0] = real[0] + imag[0];
+        data[1] = 0.0f;
+        data[size_] = real[0] - imag[0];
+        data[size_ + 1] = 0.0f;
+
+        for (int i = 1; i < half_size_ / 2; ++i) {
+          int mirror = half_size_ - i;
+          float even_real = 0.5f * (real[i] + real[mirror]);
+          float even_imag = 0.5f * (imag[i] - imag[mirror]);
+          float odd_real = 0.5f * (imag[i] + imag[mirror]);
+          float odd_imag = 0.5f * (real[mirror] - real[i]);
+          float rotated_real = split_real_[i] * odd_real - split_imag_[i] * odd_imag;
+          float rotated_imag = split_real_[i] * odd_imag + split_imag_[i] * odd_real;
+
+          data[2 * i] = even_real + rotated_real;
+          data[2 * i + 1] = even_imag + rotated_imag;
+          data[2 * mirror] = even_real - rotated_real;
+          data[2 * mirror + 1] = rotated_imag - even_imag;
+        }
+
+        int quarter = half_size_ / 2;
+        data[2 * quarter] = real[quarter];
+        data[2 * quarter + 1] = -imag[quarter];
+      }
+
+      void transformRealInverse(float* data) {
+        float scale = 1.0f / size_;
+        Buffers buffers = scratchBuffers();
+        float* real = (float*)buffers.real[0];
+        float* imag = (float*)buffers.imag[0];
+
+        // Builds the conjugate of the half size spectrum so the forward complex pass runs the inverse.
+        real[0] = scale * (data[0] + data[size_]);
+        imag[0] = scale * (data[size_] - data[0]);
+
+        for (int i = 1; i < half_size_ / 2; ++i) {
+          int mirror = half_size_ - i;
+          float even_real = data[2 * i] + data[2 * mirror];
+          float even_imag = data[2 * i + 1] - data[2 * mirror + 1];
+          float delta_real = data[2 * i] - data[2 * mirror];
+          float delta_imag = data[2 * i + 1] + data[2 * mirror + 1];
+          float odd_real = split_real_[i] * delta_real + split_imag_[i] * delta_imag;
+          float odd_imag = split_real_[i] * delta_imag - split_imag_[i] * delta_real;
+
+          real[i] = scale * (even_real - odd_imag);
+          imag[i] = -scale * (even_imag + odd_real);
+          real[mirror] = scale * (even_real + odd_imag);
+          imag[mirror] = scale * (even_imag - odd_real);
+        }
+
+        int quarter = half_size_ / 2;
+        real[quarter] = 2.0f * scale * data[2 * quarter];
+        imag[quarter] = 2.0f * scale * data[2 * quarter + 1];
+
+        int result = transformComplex(buffers);
+        real = (float*)buffers.real[result];
+        imag = (float*)buffers.imag[result];
+        for (int i = 0; i < half_size_; ++i) {
+          data[2 * i] = real[i];
+          data[2 * i + 1] = -imag[i];
+        }
+        memset(data + size_, 0, size_ * sizeof(float));
+      }
+
+    private:
+      struct Buffers {
+        poly_float* real[2];
+        poly_float* imag[2];
+      };
+
+      // Transforms are shared process wide through FFT<bits> so the ping pong buffers live per thread.
+      // A thread only runs one transform at a time so every size can share the same memory.
+      Buffers scratchBuffers() const {
+        static thread_local std::vector<poly_float> scratch;
+        if (scratch.size() < 4 * num_vectors_)
+          scratch.resize(4 * num_vectors_);
+
+        poly_float* memory = scratch.data();
+        return { { memory, memory + num_vectors_ }, { memory + 2 * num_vectors_, memory + 3 * num_vectors_ } };
+      }
+
+      // Runs the forward complex FFT on buffer 0 and returns which buffer holds the result.
+      int transformComplex(const Buffers& buffers) {
+        int source = 0;
+        int stride = 1;
+        for (int stage = 0; stage < num_stages_; ++stage) {
+          int destination = 1 - source;
+          if (stride >= kVectorSize)
+            wideStage(buffers, stride, source, destination);
+          else if (half_size_ >= 2 * kVectorSize)
+            narrowStage(buffers, stride, stage, source, destination);
+          else
+            scalarStage(buffers, stride, source, destination);
+
+          source = destination;
+          stride *= 2;
+        }
+        return source;
+      }
+
+      // Stride is a whole number of vectors: each twiddle is shared across every lane.
+      void wideStage(const Buffers& buffers, int stride, int source, int destination) {
+        const poly_float* in_real = buffers.real[source];
+        const poly_float* in_imag = buffers.imag[source];
+        poly_float* out_real = buffers.real[destination];
+        poly_float* out_imag = buffers.imag[destination];
+        const float* twiddle_real = (const float*)twiddle_real_.get();
+        const float* twiddle_imag = (const float*)twiddle_imag_.get();
+
+        int stride_vectors = stride / kVectorSize;
+        int offset = half_size_ / (2 * kVectorSize);
+        int num_groups = half_size_ / (2 * stride);
+        for (int p = 0; p < num_groups; ++p) {
+          poly_float w_real = twiddle_real[p * stride];
+          poly_float w_imag = twiddle_imag[p * stride];
+          int in_index = p * stride_vectors;
+          int out_index = 2 * p * stride_vectors;
+
+          for (int q = 0; q < stride_vectors; ++q) {
+            poly_float a_real = in_real[in_index + q];
+            poly_float a_imag = in_imag[in_index + q];
+            poly_float b_real = in_real[in_index + q + offset];
+            poly_float b_imag = in_imag[in_index + q + offset];
+            poly_float delta_real = a_real - b_real;
+            poly_float delta_imag = a_imag - b_imag;
+
+            out_real[out_index + q] = a_real + b_real;
+            out_imag[out_index + q] = a_imag + b_imag;
+            out_real[out_index + q + stride_vectors] = delta_real * w_real - delta_imag * w_imag;
+            out_imag[out_index + q + stride_vectors] = delta_real * w_imag + delta_imag * w_real;
+          }
+        }
+      }
+
+      // Stride is narrower than a vector: one vector spans several twiddle groups, and the sum and
+      // difference halves are interleaved in runs of stride lanes on the way out.
+      void narrowStage(const Buffers& buffers, int stride, int stage, int source, int destination) {
+        const poly_float* in_real = buffers.real[source];
+        const poly_float* in_imag = buffers.imag[source];
+        poly_float* out_real = buffers.real[destination];
+        poly_float* out_imag = buffers.imag[destination];
+        const poly_float* twiddle_real = stage ? lane_twiddle_real_[stage - 1].get() : twiddle_real_.get();
+        const poly_float* twiddle_imag = stage ? lane_twiddle_imag_[stage - 1].get() : twiddle_imag_.get();
+
+        int offset = half_size_ / (2 * kVectorSize);
+        for (int i = 0; i < offset; ++i) {
+          poly_float a_real = in_real[i];
+          poly_float a_imag = in_imag[i];
+          poly_float b_real = in_real[i + offset];
+          poly_float b_imag = in_imag[i + offset];
+          poly_float delta_real = a_real - b_real;
+          poly_float delta_imag = a_imag - b_imag;
+          poly_float w_real = twiddle_real[i];
+          poly_float w_imag = twiddle_imag[i];
+
+          interleave(a_real + b_real, delta_real * w_real - delta_imag * w_imag, stride,
+                     out_real + 2 * i, out_real + 2 * i + 1);
+          interleave(a_imag + b_imag, delta_real * w_imag + delta_imag * w_real, stride,
+                     out_imag + 2 * i, out_imag + 2 * i + 1);
+        }
+      }
+
+      // Transforms too small to fill two vectors.
+      void scalarStage(const Buffers& buffers, int stride, int source, int destination) {
+        const float* in_real = (const float*)buffers.real[source];
+        const float* in_imag = (const float*)buffers.imag[source];
+        float* out_real = (float*)buffers.real[destination];
+        float* out_imag = (float*)buffers.imag[destination];
+        const float* twiddle_real = (const float*)twiddle_real_.get();
+        const float* twiddle_imag = (const float*)twiddle_imag_.get();
+
+        int offset = half_size_ / 2;
+        int num_groups = offset / stride;
+        for (int p = 0; p < num_groups; ++p) {
+          float w_real = twiddle_real[p * stride];
+          float w_imag = twiddle_imag[p * stride];
+          for (int q = 0; q < stride; ++q) {
+            int in_index = q + stride * p;
+            int out_index = q + 2 * stride * p;
+            float delta_real = in_real[in_index] - in_real[in_index + offset];
+            float delta_imag = in_imag[in_index] - in_imag[in_index + offset];
+
+            out_real[out_index] = in_real[in_index] + in_real[in_index + offset];
+            out_imag[out_index] = in_imag[in_index] + in_imag[in_index + offset];
+            out_real[out_index + stride] = delta_real * w_real - delta_imag * w_imag;
+            out_imag[out_index + stride] = delta_real * w_imag + delta_imag * w_real;
+          }
+        }
+      }
+
+      // Writes runs of run_size lanes alternately from first and second across two vectors.
+      static force_inline void interleave(poly_float first, poly_float second, int run_size,
+                                          poly_float* low, poly_float* high) {
+#if VITAL_AVX2
+        __m256 low_lanes, high_lanes;
+        if (run_size == 1) {
+          low_lanes = _mm256_unpacklo_ps(first.value, second.value);
+          high_lanes = _mm256_unpackhi_ps(first.value, second.value);
+        }
+        else if (run_size == 2) {
+          low_lanes = _mm256_shuffle_ps(first.value, second.value, _MM_SHUFFLE(1, 0, 1, 0));
+          high_lanes = _mm256_shuffle_ps(first.value, second.value, _MM_SHUFFLE(3, 2, 3, 2));
+        }
+        else {
+          low_lanes = first.value;
+          high_lanes = second.value;
+        }
+        low->value = _mm256_permute2f128_ps(low_lanes, high_lanes, 0x20);
+        high->value = _mm256_permute2f128_ps(low_lanes, high_lanes, 0x31);
+#elif VITAL_SSE2
+        if (run_size == 1) {
+          low->value = _mm_unpacklo_ps(first.value, second.value);
+          high->value = _mm_unpackhi_ps(first.value, second.value);
+        }
+        else {
+          low->value = _mm_movelh_ps(first.value, second.value);
+          high->value = _mm_movehl_ps(second.value, first.value);
+        }
+#elif VITAL_NEON
+        if (run_size == 1) {
+          float32x4x2_t zipped = vzipq_f32(first.value, second.value);
+          low->value = zipped.val[0];
+          high->value = zipped.val[1];
+        }
+        else {
+          low->value = vcombine_f32(vget_low_f32(first.value), vget_low_f32(second.value));
+          high->value = vcombine_f32(vget_high_f32(first.value), vget_high_f32(second.value));
+        }
+#endif
+      }
+
+      int size_;
+      int half_size_;
+      int num_stages_;
+      size_t num_vectors_;
+      std::unique_ptr<poly_float[]> twiddle_real_;
+      std::unique_ptr<poly_float[]> twiddle_imag_;
+      std::vector<std::unique_ptr<poly_float[]>> lane_twiddle_real_;
+      std::vector<std::unique_ptr<poly_float[]>> lane_twiddle_imag_;
+      std::unique_ptr<float[]> split_real_;
+      std::unique_ptr<float[]> split_imag_;
+
+      JUCE_LEAK_DETECTOR(SimdFourierTransform)
+  };
+} // namespace vital
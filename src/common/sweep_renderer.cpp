@@ -0,0 +1,128 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sweep_renderer.h"
+#include "smooth_value.h"
+#include "synth_base.h"
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace {
+  // Jumps a control straight to _value_ if it's normally smoothed towards it.
+  void setControlHard(vital::Value* control, vital::mono_float value) {
+    if (vital::SmoothValue* smooth_value = dynamic_cast<vital::SmoothValue*>(control))
+      smooth_value->setHard(value);
+    else if (vital::cr::SmoothValue* smooth_value = dynamic_cast<vital::cr::SmoothValue*>(control))
+      smooth_value->setHard(value);
+    else
+      control->set(value);
+  }
+
+  // Renders the sweep values picked from _next_value_ until there are none left.
+  void renderValues(HeadlessSynth* synth, const SweepRenderer::Sweep& sweep, int total_samples,
+                    std::atomic<int>& next_value, float* data) {
+    // Smoothed controls would otherwise still be gliding from whatever the synth played before, so each
+    // render would depend on which thread got it and what that thread rendered first.
+    vital::control_map& controls = synth->getControls();
+    for (auto& control : controls)
+      setControlHard(control.second, control.second->value());
+
+    vital::Value* control = controls[sweep.control];
+    int num_values = static_cast<int>(sweep.values.size());
+    for (int index = next_value++; index < num_values; index = next_value++) {
+      setControlHard(control, sweep.values[index]);
+
+      float* output = data + 2 * static_cast<size_t>(total_samples) * index;
+      int num_samples = synth->renderAudioToBuffer(output, total_samples, sweep.note, sweep.velocity,
+                                                   sweep.note_duration, sweep.options);
+
+      // Put the right channel back at its full length offset and pad both channels with silence.
+      if (num_samples < total_samples) {
+        std::copy_backward(output + num_samples, output + 2 * num_samples, output + total_samples + num_samples);
+        std::fill(output + num_samples, output + total_samples, 0.0f);
+        std::fill(output + total_samples + num_samples, output + 2 * total_samples, 0.0f);
+      }
+    }
+  }
+} // namespace
+
+VitalAudioBuffer SweepRenderer::render(HeadlessSynth* synth, const Sweep& sweep, int num_threads) {
+  vital::control_map& controls = synth->getControls();
+  auto control = controls.find(sweep.control);
+  if (control == controls.end())
+    throw std::invalid_argument("No control: " + sweep.control);
+
+  int total_samples = std::max(0, sweep.options.numSamples(sweep.render_duration));
+  int num_values = static_cast<int>(sweep.values.size());
+  size_t total_frames = 2 * static_cast<size_t>(total_samples) * num_values;
+
+  std::unique_ptr<float[]> data = std::make_unique<float[]>(total_frames);
+
+  num_threads = std::max(1, std::min(num_threads, num_values));
+  // Copies load from the binary preset form, which skips JSON parsing.
+  MemoryBlock state;
+  if (num_threads > 1)
+    synth->saveToBinary(state);
+
+  // The first failure stops the rest of the sweep and is rethrown once every thread is done.
+  std::atomic<int> next_value(0);
+  std::mutex error_mutex;
+  std::exception_ptr error;
+  auto run = [&](const std::function<void()>& work) {
+    try {
+      work();
+    }
+    catch (...) {
+      next_value = num_values;
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (error == nullptr)
+        error = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; ++i) {
+    threads.emplace_back([&]() {
+      run([&]() {
+        HeadlessSynth clone;
+        std::string load_error;
+        if (!clone.loadFromBinary(state.getData(), state.getSize(), load_error))
+          throw std::runtime_error(load_error);
+        renderValues(&clone, sweep, total_samples, next_value, data.get());
+      });
+    });
+  }
+
+  vital::mono_float original_value = control->second->value();
+  run([&]() { renderValues(synth, sweep, total_samples, next_value, data.get()); });
+  control->second->set(original_value);
+
+  for (std::thread& thread : threads)
+    thread.join();
+
+  if (error)
+    std::rethrow_exception(error);
+
+  VitalAudioBuffer buffer;
+  buffer.data = data.release();
+  buffer.size = total_frames;
+  buffer.channels = 2;
+  buffer.samples_per_channel = total_samples;
+  return buffer;
+}
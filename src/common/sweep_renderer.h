@@ -0,0 +1,48 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "audio_buffer.h"
+#include "render_options.h"
+
+#include <string>
+#include <vector>
+
+class HeadlessSynth;
+
+// Renders one preset many times with a single control stepped through a list of values.
+// The synth being swept renders its share of the values itself. Every other thread gets one copy of the
+// synth, loaded once from its state, and reuses it for all the values that thread picks up. Wavetables come
+// from the wavetable cache, so the copies share their tables and skip re-rendering them.
+class SweepRenderer {
+  public:
+    struct Sweep {
+      std::string control;
+      std::vector<float> values;
+      int note = 60;
+      float velocity = 0.7f;
+      float note_duration = 2.0f;
+      float render_duration = 4.0f;
+      RenderOptions options;
+    };
+
+    // Returns every render back to back in _sweep.values_ order, each laid out like renderAudioToNumpy:
+    // the left channel, then the right. Renders that stop on silence are padded with zeros so each one
+    // takes the same space. _synth_'s control is put back to its original value afterwards.
+    static VitalAudioBuffer render(HeadlessSynth* synth, const Sweep& sweep, int num_threads);
+};
@@ -15,6 +15,8 @@
  */
 
 #include "synth_base.h"
+#include "binary_preset.h"
+#include "feature_extractor.h"
 
 // Removed nanobind dependency for Node.js addon
 #include "sample_source.h"
@@ -27,9 +29,159 @@
 #include "synth_parameters.h"
 #include "utils.h"
 
+#include <atomic>
 #include <iostream>
 #include <fstream>
 #include <filesystem>
+#include <thread>
+
+namespace {
+  // Drives the controls named by a render's automation lanes and puts their values back when done.
+  class AutomationPlayer {
+    public:
+      AutomationPlayer(vital::control_map& controls, const std::vector<AutomationLane>& lanes) {
+        for (const AutomationLane& lane : lanes) {
+          auto control = controls.find(lane.name);
+          if (control == controls.end() || lane.values.empty() || lane.times.size() != lane.values.size())
+            continue;
+
+          targets_.push_back({ &lane, control->second, control->second->value() });
+        }
+      }
+
+      ~AutomationPlayer() {
+        for (const Target& target : targets_)
+          target.control->set(target.original_value);
+      }
+
+      void update(double time) {
+        for (const Target& target : targets_)
+          target.control->set(target.lane->valueAt(time));
+      }
+
+    private:
+      struct Target {
+        const AutomationLane* lane;
+        vital::Value* control;
+        vital::mono_float original_value;
+      };
+
+      std::vector<Target> targets_;
+  };
+
+  // Turns on lean processing for one render if asked to and puts the synth's own setting back after.
+  class LeanRenderScope {
+    public:
+      LeanRenderScope(vital::SoundEngine* engine, bool lean) :
+          engine_(engine), original_lean_(engine->isLeanProcessing()) {
+        if (lean && !original_lean_)
+          engine_->setLeanProcessing(true);
+      }
+
+      ~LeanRenderScope() {
+        if (engine_->isLeanProcessing() != original_lean_)
+          engine_->setLeanProcessing(original_lean_);
+      }
+
+    private:
+      vital::SoundEngine* engine_;
+      bool original_lean_;
+  };
+
+  // Tells a render when it can stop early because everything it plays has died away.
+  class SilenceDetector {
+    public:
+      SilenceDetector(const RenderOptions& options) :
+          enabled_(options.stop_on_silence),
+          threshold_(vital::utils::dbToMagnitude(options.silence_threshold_db)),
+          hold_samples_(std::max(1, options.numSamples(options.silence_hold))), silent_samples_(0) { }
+
+      // _released_ is true once every note has been let go and the engine has no voices left.
+      bool isDone(const vital::poly_float* audio, int num_samples, bool released) {
+        if (!enabled_)
+          return false;
+
+        if (!released) {
+          silent_samples_ = 0;
+          return false;
+        }
+
+        vital::poly_float peak = 0.0f;
+        for (int i = 0; i < num_samples; ++i)
+          peak = vital::utils::max(peak, vital::poly_float::abs(audio[i]));
+
+        if (peak[0] > threshold_ || peak[1] > threshold_) {
+          silent_samples_ = 0;
+          return false;
+        }
+
+        silent_samples_ += num_samples;
+        return silent_samples_ >= hold_samples_;
+      }
+
+    private:
+      bool enabled_;
+      vital::mono_float threshold_;
+      int hold_samples_;
+      int silent_samples_;
+  };
+
+  // Runs the effect stage of a pipelined render on its own thread. The caller hands over one block at a time
+  // and waits for it before touching the engine again, so the counters are the only synchronization needed.
+  class EffectStageWorker {
+    public:
+      EffectStageWorker(vital::SoundEngine* engine) :
+          engine_(engine), block_(nullptr), seconds_(0.0), requested_(0), finished_(0), running_(true),
+          thread_(&EffectStageWorker::run, this) { }
+
+      ~EffectStageWorker() {
+        running_.store(false, std::memory_order_relaxed);
+        requested_.fetch_add(1, std::memory_order_release);
+        thread_.join();
+      }
+
+      void start(const vital::SoundEngine::PipelineBlock* block, double seconds) {
+        block_ = block;
+        seconds_ = seconds;
+        requested_.fetch_add(1, std::memory_order_release);
+      }
+
+      void wait() {
+        int requested = requested_.load(std::memory_order_relaxed);
+        while (finished_.load(std::memory_order_acquire) != requested)
+          std::this_thread::yield();
+      }
+
+    private:
+      void run() {
+        int handled = 0;
+        while (true) {
+          while (requested_.load(std::memory_order_acquire) == handled)
+            std::this_thread::yield();
+
+          if (!running_.load(std::memory_order_relaxed))
+            return;
+
+          engine_->processEffectStage(block_, seconds_);
+          finished_.store(++handled, std::memory_order_release);
+        }
+      }
+
+      vital::SoundEngine* engine_;
+      const vital::SoundEngine::PipelineBlock* block_;
+      double seconds_;
+      std::atomic<int> requested_;
+      std::atomic<int> finished_;
+      std::atomic<bool> running_;
+      std::thread thread_;
+  };
+
+  // Moves the right channel down so it starts straight after the first _num_samples_ of the left.
+  void packChannels(float* data, int num_samples, int total_samples) {
+    if (num_samples < total_samples)
+      std::copy(data + total_samples, data + total_samples + num_samples, data + num_samples);
+  }
+} // namespace
 
 SynthBase::SynthBase() : expired_(false) {
   expired_ = LoadSave::isExpired();
@@ -350,6 +502,84 @@ void SynthBase::loadTuningFile(const File& file) {
   tuning_.loadFile(file);
 }
 
+int SynthBase::trimVoices() {
+  pauseProcessing(true);
+  int num_trimmed = engine_->trimVoices();
+  pauseProcessing(false);
+  return num_trimmed;
+}
+
+int SynthBase::getNumAllocatedVoices() {
+  return engine_->getNumAllocatedVoices();
+}
+
+void SynthBase::setLeanProcessing(bool lean) {
+  ScopedLock lock(getCriticalSection());
+  engine_->setLeanProcessing(lean);
+}
+
+bool SynthBase::isLeanProcessing() {
+  return engine_->isLeanProcessing();
+}
+
+void SynthBase::setProfiling(bool profiling) {
+  ScopedLock lock(getCriticalSection());
+  engine_->setProfiling(profiling);
+}
+
+bool SynthBase::isProfiling() {
+  return engine_->isProfiling();
+}
+
+void SynthBase::resetProfile() {
+  ScopedLock lock(getCriticalSection());
+  engine_->resetProfile();
+}
+
+std::vector<vital::ProcessorProfiler::Report> SynthBase::getProfile() {
+  ScopedLock lock(getCriticalSection());
+  return engine_->getProfile();
+}
+
+void SynthBase::setWavetableRenderThreads(int num_threads) {
+  for (int i = 0; i < vital::kNumOscillators; ++i) {
+    if (getWavetableCreator(i))
+      getWavetableCreator(i)->setRenderThreads(num_threads);
+  }
+}
+
+int SynthBase::getWavetableRenderThreads() {
+  if (getWavetableCreator(0))
+    return getWavetableCreator(0)->getRenderThreads();
+  return 1;
+}
+
+int SynthBase::setWavetableKeyframe(int oscillator, int group, int component, int keyframe, const json& data) {
+  WavetableCreator* wavetable_creator = getWavetableCreator(oscillator);
+  WavetableComponent* wavetable_component = wavetable_creator->getGroup(group)->getComponent(component);
+  WavetableKeyframe* wavetable_keyframe = wavetable_component->getFrameAt(keyframe);
+
+  pauseProcessing(true);
+  try {
+    json state = wavetable_keyframe->stateToJson();
+    state.update(data);
+    int position = wavetable_keyframe->position();
+    wavetable_component->markDirty(wavetable_keyframe);
+    wavetable_keyframe->jsonToState(state);
+    if (wavetable_keyframe->position() != position)
+      wavetable_component->reposition(wavetable_keyframe);
+    wavetable_component->markDirty(wavetable_keyframe);
+
+    int num_rendered = wavetable_creator->renderDirty();
+    pauseProcessing(false);
+    return num_rendered;
+  }
+  catch (const json::exception& e) {
+    pauseProcessing(false);
+    throw e;
+  }
+}
+
 void SynthBase::loadInitPreset() {
   pauseProcessing(true);
   engine_->allSoundsOff();
@@ -375,19 +605,32 @@ bool SynthBase::loadFromJson(const json& data) {
 bool SynthBase::loadFromFile(File preset, std::string& error) {
   if (!preset.exists())
     return false;
-  
-  try {
-    json parsed_json_state = json::parse(preset.loadFileAsString().toStdString(), nullptr);
-    if (!loadFromJson(parsed_json_state)) {
-      error = "Preset was created with a newer version.";
+
+  if (BinaryPreset::isBinaryPreset(preset)) {
+    MemoryMappedFile mapped_preset(preset, MemoryMappedFile::readOnly);
+    if (mapped_preset.getData() == nullptr) {
+      error = "Couldn't open preset file.";
       return false;
     }
+    if (!loadFromBinary(mapped_preset.getData(), mapped_preset.getSize(), error))
+      return false;
 
     active_file_ = preset;
   }
-  catch (const json::exception& e) {
-    error = "Preset file is corrupted.";
-    return false;
+  else {
+    try {
+      json parsed_json_state = json::parse(preset.loadFileAsString().toStdString(), nullptr);
+      if (!loadFromJson(parsed_json_state)) {
+        error = "Preset was created with a newer version.";
+        return false;
+      }
+
+      active_file_ = preset;
+    }
+    catch (const json::exception& e) {
+      error = "Preset file is corrupted.";
+      return false;
+    }
   }
   
   setPresetName(preset.getFileNameWithoutExtension());
@@ -401,6 +644,25 @@ bool SynthBase::loadFromFile(File preset, std::string& error) {
   return true;
 }
 
+bool SynthBase::loadFromBinary(const void* data, size_t size, std::string& error) {
+  // Loading is synchronous so the audio can be read straight out of _data_ without any base64.
+  json state;
+  if (!BinaryPreset::binaryToJson(data, size, state, error, true))
+    return false;
+
+  try {
+    if (!loadFromJson(state)) {
+      error = "Preset was created with a newer version.";
+      return false;
+    }
+  }
+  catch (const json::exception& e) {
+    error = "Preset file is corrupted.";
+    return false;
+  }
+  return true;
+}
+
 bool SynthBase::pyLoadFromFile(std::string path) {
   try {
     File jsonFile(path);
@@ -448,11 +710,10 @@ void SynthBase::pySetBPM(float bpm) {
     engine_->setBpm(bpm);
 };
 
-void SynthBase::renderAudioToFile(File file, std::vector<int> notes, float velocity, float note_dur, float render_dur, bool render_images) {
-  static constexpr int kSampleRate = 44100;
+bool SynthBase::renderAudioToFile(File file, std::vector<int> notes, float velocity, float note_dur, float render_dur,
+                                  bool render_images, const RenderOptions& options) {
   static constexpr int kPreProcessSamples = 44100;
   static constexpr int kFadeSamples = 200;
-  static constexpr int kBufferSize = 64;
   static constexpr int kVideoRate = 30;
   static constexpr int kImageNumberPlaces = 3;
   static constexpr int kImageWidth = 500;
@@ -461,21 +722,15 @@ void SynthBase::renderAudioToFile(File file, std::vector<int> notes, float veloc
 
   ScopedLock lock(getCriticalSection());
 
-  engine_->allSoundsOff(); // note: dbraun added this
+  AutomationPlayer automation(controls_, options.automation);
+  automation.update(0.0);
+  LeanRenderScope lean_scope(engine_.get(), options.lean);
 
-  processModulationChanges();
-  engine_->setSampleRate(kSampleRate);
-//  engine_->setBpm(bpm);
-  engine_->updateAllModulationSwitches();
+  int sample_rate = options.sample_rate;
+  int block_size = vital::utils::iclamp(options.block_size, 1, vital::kMaxBufferSize);
 
+  double current_time = prepareOfflineRender(options, block_size, kPreProcessSamples);
   double sample_time = 1.0 / getSampleRate();
-  double current_time = -kPreProcessSamples * sample_time;
-
-  for (int samples = 0; samples < kPreProcessSamples; samples += kBufferSize) {
-    engine_->correctToTime(current_time);
-    current_time += kBufferSize * sample_time;
-    engine_->process(kBufferSize);
-  }
 
   for (int note : notes)
     engine_->noteOn(note, velocity, 0, 0);
@@ -483,14 +738,18 @@ void SynthBase::renderAudioToFile(File file, std::vector<int> notes, float veloc
   file.deleteFile();
   std::unique_ptr<FileOutputStream> file_stream = file.createOutputStream();
   WavAudioFormat wav_format;
-  std::unique_ptr<AudioFormatWriter> writer(wav_format.createWriterFor(file_stream.get(), kSampleRate, 2, 16, {}, 0));
+  std::unique_ptr<AudioFormatWriter> writer(wav_format.createWriterFor(file_stream.get(), sample_rate, 2,
+                                                                      options.bit_depth, {}, 0));
+  if (writer == nullptr)
+    return false;
 
-  int on_samples = note_dur * kSampleRate;
-  int total_samples = render_dur * kSampleRate;
-  std::unique_ptr<float[]> left_buffer = std::make_unique<float[]>(kBufferSize);
-  std::unique_ptr<float[]> right_buffer = std::make_unique<float[]>(kBufferSize);
+  int on_samples = options.numSamples(note_dur);
+  int total_samples = options.numSamples(render_dur);
+  std::unique_ptr<float[]> left_buffer = std::make_unique<float[]>(block_size);
+  std::unique_ptr<float[]> right_buffer = std::make_unique<float[]>(block_size);
   float* buffers[2] = { left_buffer.get(), right_buffer.get() };
   const vital::mono_float* engine_output = (const vital::mono_float*)engine_->output(0)->buffer;
+  SilenceDetector silence(options);
 
 #if JUCE_MODULE_AVAILABLE_juce_graphics
   int current_image_index = -1;
@@ -501,28 +760,35 @@ void SynthBase::renderAudioToFile(File file, std::vector<int> notes, float veloc
   const vital::poly_float* memory = getOscilloscopeMemory();
 #endif
 
-  for (int samples = 0; samples < total_samples; samples += kBufferSize) {
+  for (int samples = 0; samples < total_samples; samples += block_size) {
+    automation.update(samples * sample_time);
     engine_->correctToTime(current_time);
-    current_time += kBufferSize * sample_time;
-    engine_->process(kBufferSize);
-    updateMemoryOutput(kBufferSize, engine_->output(0)->buffer);
+    current_time += block_size * sample_time;
+    engine_->process(block_size);
+    if (!engine_->isLeanProcessing() || render_images)
+      updateMemoryOutput(block_size, engine_->output(0)->buffer);
 
-    if (on_samples > samples && on_samples <= samples + kBufferSize) {
+    if (on_samples > samples && on_samples <= samples + block_size) {
       for (int note : notes)
         engine_->noteOff(note, 0.5f, 0, 0);
     }
 
-    for (int i = 0; i < kBufferSize; ++i) {
+    int block_samples = std::min(block_size, total_samples - samples);
+    for (int i = 0; i < block_samples; ++i) {
       vital::mono_float t = (total_samples - samples) / (1.0f * kFadeSamples);
       t = vital::utils::min(t, 1.0f);
       left_buffer[i] = t * engine_output[vital::poly_float::kSize * i];
       right_buffer[i] = t * engine_output[vital::poly_float::kSize * i + 1];
     }
 
-    writer->writeFromFloatArrays(buffers, 2, kBufferSize);
+    writer->writeFromFloatArrays(buffers, 2, block_samples);
+
+    bool released = on_samples <= samples + block_size && engine_->getNumActiveVoices() == 0;
+    if (silence.isDone(engine_->output(0)->buffer, block_samples, released))
+      break;
 
   #if JUCE_MODULE_AVAILABLE_juce_graphics
-    int image_index = (samples * kVideoRate) / kSampleRate;
+    int image_index = (samples * kVideoRate) / sample_rate;
     if (image_index > current_image_index && render_images) {
       current_image_index = image_index;
       String number(image_index);
@@ -572,81 +838,232 @@ void SynthBase::renderAudioToFile(File file, std::vector<int> notes, float veloc
 
   writer = nullptr;
   file_stream.release();
+  return true;
+}
+
+VitalAudioBuffer SynthBase::renderAudioToNumpy(const int& midi_note, float velocity, float note_dur, float render_dur,
+                                               const RenderOptions& options, FeatureExtractor* features) {
+  int total_samples = options.numSamples(render_dur);
+  size_t total_frames = static_cast<size_t>(total_samples * 2);  // stereo: 2 channels
+
+  // Every sample gets written by renderAudioToBuffer so there's no need to zero this.
+  float* data = new float[total_frames];
+  int num_samples = renderAudioToBuffer(data, total_samples, midi_note, velocity, note_dur, options, features);
+
+  // Return the data as a VitalAudioBuffer
+  VitalAudioBuffer buffer;
+  buffer.data = data;
+  buffer.size = static_cast<size_t>(num_samples * 2); // left channel followed by right channel
+  buffer.channels = 2;
+  buffer.samples_per_channel = num_samples;
+  return buffer;
 }
 
-VitalAudioBuffer SynthBase::renderAudioToNumpy(const int& midi_note, float velocity, float note_dur, float render_dur) {
-  static constexpr int kSampleRate = 44100;
+int SynthBase::renderAudioToBuffer(float* data, int total_samples, const int& midi_note,
+                                    float velocity, float note_dur, const RenderOptions& options,
+                                    FeatureExtractor* features) {
+  auto write = [&](const vital::mono_float* output, int samples, int block_samples, vital::mono_float gain) {
+    for (int i = 0; i < block_samples; ++i) {
+      data[samples + i] = gain * output[vital::poly_float::kSize * i];
+      data[samples + i + total_samples] = gain * output[vital::poly_float::kSize * i + 1];
+    }
+    if (features)
+      features->process(data + samples, data + samples + total_samples, block_samples);
+    return true;
+  };
+
+  int num_samples = renderNote(total_samples, midi_note, velocity, note_dur, options, write);
+  if (features)
+    features->finish();
+  packChannels(data, num_samples, total_samples);
+  return num_samples;
+}
+
+int SynthBase::renderAudioToStream(const int& midi_note, float velocity, float note_dur, float render_dur,
+                                   int chunk_samples, const RenderOptions& options,
+                                   const std::function<bool(const float*, int)>& write_chunk) {
+  int total_samples = options.numSamples(render_dur);
+  chunk_samples = std::max(1, chunk_samples);
+  std::vector<float> chunk(2 * chunk_samples);
+  int chunk_fill = 0;
+  int delivered = 0;
+
+  auto write = [&](const vital::mono_float* output, int samples, int block_samples, vital::mono_float gain) {
+    for (int i = 0; i < block_samples; ++i) {
+      chunk[2 * chunk_fill] = gain * output[vital::poly_float::kSize * i];
+      chunk[2 * chunk_fill + 1] = gain * output[vital::poly_float::kSize * i + 1];
+      if (++chunk_fill == chunk_samples) {
+        chunk_fill = 0;
+        if (!write_chunk(chunk.data(), chunk_samples))
+          return false;
+        delivered += chunk_samples;
+      }
+    }
+    return true;
+  };
+
+  // A cancelled render always stops on a chunk boundary so anything left over is the short final chunk.
+  renderNote(total_samples, midi_note, velocity, note_dur, options, write);
+  if (chunk_fill && write_chunk(chunk.data(), chunk_fill))
+    delivered += chunk_fill;
+  return delivered;
+}
+
+int SynthBase::renderNote(int total_samples, int midi_note, float velocity, float note_dur,
+                          const RenderOptions& options,
+                          const std::function<bool(const vital::mono_float*, int, int, vital::mono_float)>& write) {
   static constexpr int kFadeSamples = 200;
-  static constexpr int kBufferSize = 64;
   static constexpr int kPreProcessSamples = 256; // note: dbraun decreased this from 44100.
 
-  // Release GIL for the performance-critical section
-  // nb::gil_scoped_release gil_release;  // TODO:
-  
   ScopedLock lock(getCriticalSection());
 
-  engine_->allSoundsOff();  // note: dbraun added this
+  AutomationPlayer automation(controls_, options.automation);
+  automation.update(0.0);
+  LeanRenderScope lean_scope(engine_.get(), options.lean);
 
-  processModulationChanges();
-  engine_->setSampleRate(kSampleRate);
-  engine_->updateAllModulationSwitches();
-
-  // Preprocess modulation
+  int block_size = vital::utils::iclamp(options.block_size, 1, vital::kMaxBufferSize);
+  double current_time = prepareOfflineRender(options, block_size, kPreProcessSamples);
   double sample_time = 1.0 / getSampleRate();
-  double current_time = -kPreProcessSamples * sample_time;
-
-  for (int samples = 0; samples < kPreProcessSamples; samples += kBufferSize) {
-    engine_->correctToTime(current_time);
-    current_time += kBufferSize * sample_time;
-    engine_->process(kBufferSize);
-  }
 
   engine_->noteOn(midi_note, velocity, 0, 0);
 
-  int on_samples = note_dur * kSampleRate;
-  int total_samples = render_dur * kSampleRate;
+  int on_samples = options.numSamples(note_dur);
   const vital::mono_float* engine_output =
       (const vital::mono_float*)engine_->output(0)->buffer;
+  SilenceDetector silence(options);
 
-  size_t total_frames =
-      static_cast<size_t>(total_samples * 2);  // stereo: 2 channels
+  auto prepare = [&](int samples, int block_samples) {
+    automation.update(samples * sample_time);
+  };
 
-  auto* data = new float[total_frames]();  // Zero-initialized
+  auto voices_done = [&](int samples, int block_samples) {
+    if (on_samples > samples && on_samples <= samples + block_size) {
+      engine_->noteOff(midi_note, 0.5f, 0, 0);
+    }
+    return on_samples <= samples + block_size && engine_->getNumActiveVoices() == 0;
+  };
 
-  int baseSample = 0;
+  auto consume = [&](int samples, int block_samples, bool released) {
+    vital::mono_float gain = (total_samples - samples) / (1.0f * kFadeSamples);
+    gain = vital::utils::min(gain, 1.0f);
+    if (!write(engine_output, samples, block_samples, gain))
+      return true;
+    return silence.isDone(engine_->output(0)->buffer, block_samples, released);
+  };
 
-  for (int samples = 0; samples < total_samples; samples += kBufferSize) {
-    engine_->correctToTime(current_time);
-    current_time += kBufferSize * sample_time;
-    engine_->process(kBufferSize);
-    updateMemoryOutput(kBufferSize, engine_->output(0)->buffer);
+  return renderBlocks(total_samples, block_size, current_time, true, canPipelineRender(options),
+                      prepare, voices_done, consume);
+}
 
-    if (on_samples > samples && on_samples <= samples + kBufferSize) {
-      engine_->noteOff(midi_note, 0.5f, 0, 0);
-    }
+VitalAudioBuffer SynthBase::renderSequence(const RenderSequence& sequence, float render_dur,
+                                           const RenderOptions& options, FeatureExtractor* features) {
+  int total_samples = options.numSamples(render_dur);
+  size_t total_frames = static_cast<size_t>(total_samples * 2);
 
-    for (int i = 0; i < kBufferSize; ++i) {
-      vital::mono_float t = (total_samples - samples) / (1.0f * kFadeSamples);
-      t = vital::utils::min(t, 1.0f);
-      baseSample = samples + i;
-      if (baseSample < total_samples) {
-        data[samples + i] = t * engine_output[vital::poly_float::kSize * i];
-        data[samples + i + total_samples] =
-            t * engine_output[vital::poly_float::kSize * i + 1];
-	  }
-    }
-  }
+  float* data = new float[total_frames];
+  int num_samples = renderSequenceToBuffer(data, total_samples, sequence, options, features);
 
-  // Return the data as a VitalAudioBuffer
   VitalAudioBuffer buffer;
   buffer.data = data;
-  buffer.size = total_samples * 2; // stereo interleaved
+  buffer.size = static_cast<size_t>(num_samples * 2);
   buffer.channels = 2;
-  buffer.samples_per_channel = total_samples;
+  buffer.samples_per_channel = num_samples;
   return buffer;
 }
 
-bool SynthBase::renderAudioToFile2(const std::string& output_path, const int& midi_note, float velocity, float note_dur, float render_dur) {
+int SynthBase::renderSequenceToBuffer(float* data, int total_samples, const RenderSequence& sequence,
+                                       const RenderOptions& options, FeatureExtractor* features) {
+  static constexpr int kFadeSamples = 200;
+  static constexpr int kPreProcessSamples = 256;
+
+  ScopedLock lock(getCriticalSection());
+
+  AutomationPlayer automation(controls_, options.automation);
+  automation.update(0.0);
+  LeanRenderScope lean_scope(engine_.get(), options.lean);
+
+  int block_size = vital::utils::iclamp(options.block_size, 1, vital::kMaxBufferSize);
+  double current_time = prepareOfflineRender(options, block_size, kPreProcessSamples);
+  double sample_time = 1.0 / getSampleRate();
+
+  const std::vector<RenderEvent>& events = sequence.events();
+  VITAL_ASSERT(std::is_sorted(events.begin(), events.end(), [](const RenderEvent& a, const RenderEvent& b) {
+    return a.sample < b.sample;
+  }));
+
+  // Wheels and pressure persist in the engine, so start from neutral and put them back afterwards.
+  resetPerformanceControls();
+
+  size_t event_index = 0;
+  const vital::mono_float* engine_output = (const vital::mono_float*)engine_->output(0)->buffer;
+  SilenceDetector silence(options);
+
+  auto prepare = [&](int samples, int block_samples) {
+    int block_end = samples + block_samples;
+    for (; event_index < events.size() && events[event_index].sample < block_end; ++event_index)
+      processRenderEvent(events[event_index], std::max(0, events[event_index].sample - samples));
+
+    automation.update(samples * sample_time);
+  };
+
+  auto voices_done = [&](int samples, int block_samples) {
+    return event_index == events.size() && engine_->getNumActiveVoices() == 0;
+  };
+
+  auto consume = [&](int samples, int block_samples, bool released) {
+    for (int i = 0; i < block_samples; ++i) {
+      vital::mono_float t = (total_samples - samples) / (1.0f * kFadeSamples);
+      t = vital::utils::min(t, 1.0f);
+      data[samples + i] = t * engine_output[vital::poly_float::kSize * i];
+      data[samples + i + total_samples] = t * engine_output[vital::poly_float::kSize * i + 1];
+    }
+    if (features)
+      features->process(data + samples, data + samples + total_samples, block_samples);
+    return silence.isDone(engine_->output(0)->buffer, block_samples, released);
+  };
+
+  // MIDI messages can reach any control through MIDI learn, so they keep the render serial.
+  bool pipelined = std::none_of(events.begin(), events.end(), [](const RenderEvent& event) {
+    return event.type == RenderEvent::kMidiMessage;
+  }) && canPipelineRender(options);
+
+  int num_samples = renderBlocks(total_samples, block_size, current_time, false, pipelined,
+                                 prepare, voices_done, consume);
+  if (features)
+    features->finish();
+  packChannels(data, num_samples, total_samples);
+  resetPerformanceControls();
+  return num_samples;
+}
+
+bool SynthBase::renderSequenceToFile(const std::string& output_path, const RenderSequence& sequence,
+                                     float render_dur, const RenderOptions& options) {
+  File file(output_path);
+  if (!file.hasWriteAccess())
+    return false;
+
+  VitalAudioBuffer audio = renderSequence(sequence, render_dur, options);
+  std::unique_ptr<float[]> data(audio.data);
+
+  file.deleteFile();
+  std::unique_ptr<FileOutputStream> file_stream = file.createOutputStream();
+  if (file_stream == nullptr)
+    return false;
+
+  WavAudioFormat wav_format;
+  std::unique_ptr<AudioFormatWriter> writer(wav_format.createWriterFor(file_stream.get(), options.sample_rate, 2,
+                                                                      options.bit_depth, {}, 0));
+  if (writer == nullptr)
+    return false;
+
+  file_stream.release();
+  int num_samples = static_cast<int>(audio.samples_per_channel);
+  const float* channels[2] = { data.get(), data.get() + num_samples };
+  return writer->writeFromFloatArrays(channels, 2, num_samples);
+}
+
+bool SynthBase::renderAudioToFile2(const std::string& output_path, const int& midi_note, float velocity, float note_dur, float render_dur,
+                                   const RenderOptions& options) {
     File output_file(output_path);
     if (!output_file.hasWriteAccess()) {
       std::cout << "Error: Don't have permission to write output file." << newLine;
@@ -655,8 +1072,7 @@ bool SynthBase::renderAudioToFile2(const std::string& output_path, const int& mi
     bool render_images = false;
     std::vector<int> midi_notes = {midi_note};
     
-    renderAudioToFile(output_file, midi_notes, velocity, note_dur, render_dur, render_images);
-    return true;
+    return renderAudioToFile(output_file, midi_notes, velocity, note_dur, render_dur, render_images, options);
 }
 
 
@@ -721,6 +1137,34 @@ bool SynthBase::saveToFile(File preset) {
   return false;
 }
 
+bool SynthBase::saveToBinaryFile(File preset) {
+  preset = preset.withFileExtension(String(vital::kBinaryPresetExtension));
+
+  File parent = preset.getParentDirectory();
+  if (!parent.exists()) {
+    if (!parent.createDirectory().wasOk() || !parent.hasWriteAccess())
+      return false;
+  }
+
+  setPresetName(preset.getFileNameWithoutExtension());
+
+  SynthGuiInterface* gui_interface = getGuiInterface();
+  if (gui_interface)
+    gui_interface->notifyFresh();
+
+  MemoryBlock data;
+  saveToBinary(data);
+  if (preset.replaceWithData(data.getData(), data.getSize())) {
+    active_file_ = preset;
+    return true;
+  }
+  return false;
+}
+
+void SynthBase::saveToBinary(MemoryBlock& output) {
+  BinaryPreset::jsonToBinary(saveToJson(), output);
+}
+
 bool SynthBase::saveToActiveFile() {
   if (!active_file_.exists() || !active_file_.hasWriteAccess())
     return false;
@@ -760,7 +1204,8 @@ void SynthBase::writeAudio(AudioSampleBuffer* buffer, int channels, int samples,
     }
   }
 
-  updateMemoryOutput(samples, engine_->output(0)->buffer);
+  if (!engine_->isLeanProcessing())
+    updateMemoryOutput(samples, engine_->output(0)->buffer);
 }
 
 void SynthBase::processMidi(MidiBuffer& midi_messages, int start_sample, int end_sample) {
@@ -772,6 +1217,151 @@ void SynthBase::processMidi(MidiBuffer& midi_messages, int start_sample, int end
   }
 }
 
+void SynthBase::processRenderEvent(const RenderEvent& event, int sample_offset) {
+  switch (event.type) {
+    case RenderEvent::kNoteOn:
+      engine_->noteOn(event.note, event.value, sample_offset, event.channel);
+      break;
+    case RenderEvent::kNoteOff:
+      engine_->noteOff(event.note, event.value, sample_offset, event.channel);
+      break;
+    case RenderEvent::kPitchBend:
+      engine_->setPitchWheel(event.value, event.channel);
+      break;
+    case RenderEvent::kModWheel:
+      engine_->setModWheel(event.value, event.channel);
+      break;
+    case RenderEvent::kAftertouch:
+      engine_->setAftertouch(event.note, event.value, sample_offset, event.channel);
+      break;
+    case RenderEvent::kChannelPressure:
+      engine_->setChannelAftertouch(event.channel, event.value, sample_offset);
+      break;
+    case RenderEvent::kMidiMessage:
+      midi_manager_->processMidiMessage(event.message, sample_offset);
+      break;
+  }
+}
+
+void SynthBase::resetPerformanceControls() {
+  engine_->setZonedPitchWheel(0.0f, 0, vital::kNumMidiChannels - 1);
+  engine_->setModWheelAllChannels(0.0f);
+  engine_->setChannelRangeAftertouch(0, vital::kNumMidiChannels - 1, 0.0f, 0);
+}
+
+double SynthBase::prepareOfflineRender(const RenderOptions& options, int block_size, int preprocess_samples) {
+  engine_->allSoundsOff();  // note: dbraun added this
+
+  processModulationChanges();
+  engine_->setSampleRate(options.sample_rate);
+  engine_->checkOversampling();
+  engine_->updateAllModulationSwitches();
+  if (options.seeded) {
+    // Reused voices carry state from earlier renders, so seeded renders start from fresh clones.
+    engine_->trimVoices();
+    engine_->setRandomSeed(options.seed);
+  }
+
+  // Preprocess modulation
+  double sample_time = 1.0 / getSampleRate();
+  double current_time = -preprocess_samples * sample_time;
+
+  for (int samples = 0; samples < preprocess_samples; samples += block_size) {
+    engine_->correctToTime(current_time);
+    current_time += block_size * sample_time;
+    engine_->process(block_size);
+  }
+  return current_time;
+}
+
+bool SynthBase::canPipelineRender(const RenderOptions& options) {
+  if (!options.pipelined)
+    return false;
+
+  std::vector<std::string> changing_controls;
+  for (const AutomationLane& lane : options.automation)
+    changing_controls.push_back(lane.name);
+  for (vital::ModulationConnection* connection : mod_connections_)
+    changing_controls.push_back(connection->destination_name);
+
+  return engine_->canPipeline(changing_controls);
+}
+
+int SynthBase::renderBlocks(int total_samples, int block_size, double start_time, bool whole_blocks, bool pipelined,
+                            const std::function<void(int, int)>& prepare,
+                            const std::function<bool(int, int)>& voices_done,
+                            const std::function<bool(int, int, bool)>& consume) {
+  double sample_time = 1.0 / getSampleRate();
+  double current_time = start_time;
+
+  if (!pipelined) {
+    for (int samples = 0; samples < total_samples; samples += block_size) {
+      int block_samples = std::min(block_size, total_samples - samples);
+      int process_samples = whole_blocks ? block_size : block_samples;
+      prepare(samples, block_samples);
+      engine_->correctToTime(current_time);
+      current_time += process_samples * sample_time;
+      engine_->process(process_samples);
+      if (!engine_->isLeanProcessing())
+        updateMemoryOutput(process_samples, engine_->output(0)->buffer);
+
+      bool released = voices_done(samples, block_samples);
+      if (consume(samples, block_samples, released))
+        return samples + block_samples;
+    }
+    return total_samples;
+  }
+
+  // Two blocks in flight: the voices fill one while the worker runs the effects of the other.
+  struct PendingBlock {
+    vital::SoundEngine::PipelineBlock block;
+    double time = 0.0;
+    int start = 0;
+    int length = 0;
+    bool released = false;
+  };
+  PendingBlock pending[2];
+  PendingBlock* previous = nullptr;
+
+  auto finish = [&](PendingBlock* finished) {
+    if (!engine_->isLeanProcessing()) {
+      engine_->updateStatusOutputs();
+      updateMemoryOutput(finished->block.num_samples, engine_->output(0)->buffer);
+    }
+    return consume(finished->start, finished->length, finished->released);
+  };
+
+  EffectStageWorker worker(engine_.get());
+  for (int samples = 0; samples < total_samples; samples += block_size) {
+    PendingBlock* current = &pending[(samples / block_size) % 2];
+    current->start = samples;
+    current->length = std::min(block_size, total_samples - samples);
+    current->time = current_time;
+
+    int process_samples = whole_blocks ? block_size : current->length;
+    prepare(samples, current->length);
+    engine_->prepareVoiceStage(process_samples, current_time);
+    current_time += process_samples * sample_time;
+
+    if (previous)
+      worker.start(&previous->block, previous->time);
+    engine_->processVoiceStage(process_samples, &current->block);
+    worker.wait();
+
+    current->released = voices_done(samples, current->length);
+    if (previous && finish(previous))
+      return previous->start + previous->length;
+    previous = current;
+  }
+
+  if (previous) {
+    engine_->processEffectStage(&previous->block, previous->time);
+    if (finish(previous))
+      return previous->start + previous->length;
+  }
+  return total_samples;
+}
+
 void SynthBase::processKeyboardEvents(MidiBuffer& buffer, int num_samples) {
   midi_manager_->replaceKeyboardMessages(buffer, num_samples);
 }
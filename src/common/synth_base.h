@@ -22,14 +22,18 @@
 #include "synth_constants.h"
 #include "synth_types.h"
 #include "midi_manager.h"
+#include "processor_profiler.h"
 #include "tuning.h"
 #include "wavetable_creator.h"
 
+#include <functional>
 #include <set>
 #include <string>
 
 #include <filesystem>
 #include "audio_buffer.h"
+#include "render_options.h"
+#include "render_sequence.h"
 
 
 namespace vital {
@@ -42,6 +46,7 @@ namespace vital {
   class Wavetable;
 }
 
+class FeatureExtractor;
 class SynthGuiInterface;
 
 class SynthBase : public MidiManager::Listener {
@@ -91,11 +96,56 @@ class SynthBase : public MidiManager::Listener {
     bool pyLoadFromFile(std::string path);
     std::string pyToJson() { return saveToJson().dump(); }
     bool loadFromString(std::string json_text);
-    void renderAudioToFile(File file, std::vector<int> notes, float velocity, float note_dur, float render_dur, bool render_images);
-    bool renderAudioToFile2(const std::string& output_path, const int& midi_note, float velocity, float note_dur, float render_dur);
-    VitalAudioBuffer renderAudioToNumpy(const int& midi_note, float velocity, float note_dur, float render_dur);
+    bool loadFromBinary(const void* data, size_t size, std::string& error);
+    bool renderAudioToFile(File file, std::vector<int> notes, float velocity, float note_dur, float render_dur, bool render_images,
+                           const RenderOptions& options = RenderOptions());
+    bool renderAudioToFile2(const std::string& output_path, const int& midi_note, float velocity, float note_dur, float render_dur,
+                            const RenderOptions& options = RenderOptions());
+    VitalAudioBuffer renderAudioToNumpy(const int& midi_note, float velocity, float note_dur, float render_dur,
+                                        const RenderOptions& options = RenderOptions(),
+                                        FeatureExtractor* features = nullptr);
+    // Renders into _data_ with the left channel in the first _total_samples_ floats, right channel after.
+    // Returns the number of samples per channel, which is less than _total_samples_ if the render stopped on
+    // silence. The right channel then starts right after the shortened left one.
+    // _features_, if given, is fed each block as it's written and finished at the end.
+    int renderAudioToBuffer(float* data, int total_samples, const int& midi_note, float velocity, float note_dur,
+                             const RenderOptions& options = RenderOptions(), FeatureExtractor* features = nullptr);
+    // Renders like renderAudioToBuffer but hands the audio to _write_chunk_ in interleaved stereo chunks of
+    // _chunk_samples_ frames as it goes. Only the last chunk can be shorter. _write_chunk_ may block to hold
+    // the render back and returns false to cancel it. The synth stays locked until this returns.
+    // Returns the number of frames delivered.
+    int renderAudioToStream(const int& midi_note, float velocity, float note_dur, float render_dur,
+                            int chunk_samples, const RenderOptions& options,
+                            const std::function<bool(const float*, int)>& write_chunk);
+    // Plays every event in _sequence_ at its sample position in one continuous pass. Same layout as above.
+    int renderSequenceToBuffer(float* data, int total_samples, const RenderSequence& sequence,
+                                const RenderOptions& options = RenderOptions(), FeatureExtractor* features = nullptr);
+    VitalAudioBuffer renderSequence(const RenderSequence& sequence, float render_dur,
+                                    const RenderOptions& options = RenderOptions(),
+                                    FeatureExtractor* features = nullptr);
+    bool renderSequenceToFile(const std::string& output_path, const RenderSequence& sequence, float render_dur,
+                              const RenderOptions& options = RenderOptions());
     void renderAudioForResynthesis(float* data, int samples, int note);
+    // Voices are cloned as notes need them. This frees the ones that aren't sounding and returns how many.
+    int trimVoices();
+    int getNumAllocatedVoices();
+    // Lean processing skips the meters, status outputs and oscilloscope memory. Audio is unchanged.
+    void setLeanProcessing(bool lean);
+    bool isLeanProcessing();
+    // Profiling charges render time to modules such as "osc_1" or "reverb" until it is turned off or reset.
+    void setProfiling(bool profiling);
+    bool isProfiling();
+    void resetProfile();
+    std::vector<vital::ProcessorProfiler::Report> getProfile();
+    // Wavetables spread their frames over this many threads when they render, e.g. on preset load.
+    void setWavetableRenderThreads(int num_threads);
+    int getWavetableRenderThreads();
+    // Applies _data_ over the keyframe's settings and renders only the frames the keyframe reaches.
+    // Returns the number of frames rendered.
+    int setWavetableKeyframe(int oscillator, int group, int component, int keyframe, const json& data);
     bool saveToFile(File preset);
+    bool saveToBinaryFile(File preset);
+    void saveToBinary(MemoryBlock& output);
     bool saveToActiveFile();
     void clearActiveFile() { active_file_ = File(); }
     File getActiveFile() { return active_file_; }
@@ -173,6 +223,22 @@ class SynthBase : public MidiManager::Listener {
     void processKeyboardEvents(MidiBuffer& buffer, int num_samples);
     void processModulationChanges();
     void updateMemoryOutput(int samples, const vital::poly_float* audio);
+    double prepareOfflineRender(const RenderOptions& options, int block_size, int preprocess_samples);
+    bool canPipelineRender(const RenderOptions& options);
+    // Runs the blocks of an offline render, serially or pipelined. _prepare_ sets up a block before its voices
+    // run. _voices_done_ is called right after them and says whether everything has been released and has
+    // finished. _consume_ reads the engine output for a block and returns true to end the render there.
+    // Returns the number of samples rendered.
+    int renderBlocks(int total_samples, int block_size, double start_time, bool whole_blocks, bool pipelined,
+                     const std::function<void(int, int)>& prepare,
+                     const std::function<bool(int, int)>& voices_done,
+                     const std::function<bool(int, int, bool)>& consume);
+    // Plays one note for _total_samples_. _write_ gets each block of engine output with the gain of the closing
+    // fade and returns false to stop the render there. Returns the number of samples rendered.
+    int renderNote(int total_samples, int midi_note, float velocity, float note_dur, const RenderOptions& options,
+                   const std::function<bool(const vital::mono_float*, int, int, vital::mono_float)>& write);
+    void processRenderEvent(const RenderEvent& event, int sample_offset);
+    void resetPerformanceControls();
 
     std::unique_ptr<vital::SoundEngine> engine_;
     std::unique_ptr<MidiManager> midi_manager_;
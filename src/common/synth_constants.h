@@ -50,6 +50,7 @@ namespace vital {
   const std::wstring kDefaultKeyboard = L"awsedftgyhujkolp;'";
 
   const std::string kPresetExtension = "vital";
+  const std::string kBinaryPresetExtension = "vitalb";
   const std::string kWavetableExtension = "vitaltable";
   const std::string kWavetableExtensionsList = "*." + vital::kWavetableExtension + ";*.wav;*.flac";
   const std::string kSampleExtensionsList = "*.wav;*.flac";
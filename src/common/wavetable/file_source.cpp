@@ -15,6 +15,7 @@
  */
 
 #include "file_source.h"
+#include "audio_block.h"
 
 FileSource::FileSourceKeyframe::FileSourceKeyframe(SampleBuffer* sample_buffer) {
   sample_buffer_ = sample_buffer;
@@ -221,7 +222,7 @@ void FileSource::FileSourceKeyframe::jsonToState(json data) {
   window_size_ = data["window_size"];
 }
 
-FileSource::FileSource() : compute_frame_(&sample_buffer_), overridden_phase_(),
+FileSource::FileSource() : overridden_phase_(),
                            fade_style_(kWaveBlend), phase_style_(kNone),
                            normalize_gain_(false), normalize_mult_(false),
                            random_generator_(-vital::kPi, vital::kPi) {
@@ -235,18 +236,24 @@ WavetableKeyframe* FileSource::createKeyframe(int position) {
   return keyframe;
 }
 
-void FileSource::render(vital::WaveFrame* wave_frame, float position) {
+std::unique_ptr<WavetableComponent::RenderScratch> FileSource::createRenderScratch() {
+  return std::make_unique<FileSourceScratch>(&sample_buffer_);
+}
+
+void FileSource::renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) {
   if (sample_buffer_.data == nullptr)
     wave_frame->clear();
   else {
-    interpolate(&compute_frame_, position);
-    compute_frame_.setWindowSize(window_size_);
-    compute_frame_.setFadeStyle(fade_style_);
-    compute_frame_.setPhaseStyle(phase_style_);
-    compute_frame_.setInterpolateFromFrame(&interpolate_from_frame_);
-    compute_frame_.setInterpolateToFrame(&interpolate_to_frame_);
-    compute_frame_.setOverriddenPhaseBuffer(overridden_phase_);
-    compute_frame_.render(wave_frame);
+    FileSourceScratch* file_scratch = static_cast<FileSourceScratch*>(scratch);
+    FileSourceKeyframe* compute_frame = static_cast<FileSourceKeyframe*>(scratch->compute_frame.get());
+    interpolate(compute_frame, position);
+    compute_frame->setWindowSize(window_size_);
+    compute_frame->setFadeStyle(fade_style_);
+    compute_frame->setPhaseStyle(phase_style_);
+    compute_frame->setInterpolateFromFrame(&file_scratch->interpolate_from_frame);
+    compute_frame->setInterpolateToFrame(&file_scratch->interpolate_to_frame);
+    compute_frame->setOverriddenPhaseBuffer(overridden_phase_);
+    compute_frame->render(wave_frame);
     wave_frame->setFrequencyRatio(window_size_ / vital::WaveFrame::kWaveformSize);
     wave_frame->setSampleRate(sample_buffer_.sample_rate);
     if (normalize_mult_)
@@ -312,12 +319,12 @@ void FileSource::jsonToState(json data) {
     sample_rate = data["audio_sample_rate"];
 
   MemoryOutputStream decoded;
-  std::string audio_data = data["audio_file"];
-  Base64::convertFromBase64(decoded, audio_data);
+  size_t data_size = 0;
+  const void* audio_data = vital::audio_block::read(data["audio_file"], decoded, data_size);
 
-  int size = static_cast<int>(decoded.getDataSize()) / sizeof(int16_t);
+  int size = static_cast<int>(data_size / sizeof(int16_t));
   std::unique_ptr<float[]> float_data = std::make_unique<float[]>(size);
-  vital::utils::pcmToFloatData(float_data.get(), (int16_t*)decoded.getData(), size);
+  vital::utils::pcmToFloatData(float_data.get(), static_cast<const int16_t*>(audio_data), size);
   loadBuffer(float_data.get(), size, sample_rate);
 }
 
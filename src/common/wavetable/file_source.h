@@ -123,7 +123,8 @@ class FileSource : public WavetableComponent {
     virtual ~FileSource() { }
 
     WavetableKeyframe* createKeyframe(int position) override;
-    void render(vital::WaveFrame* wave_frame, float position) override;
+    std::unique_ptr<RenderScratch> createRenderScratch() override;
+    void renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) override;
     WavetableComponentFactory::ComponentType getType() override;
     json stateToJson() override;
     void jsonToState(json data) override;
@@ -153,9 +154,13 @@ class FileSource : public WavetableComponent {
     force_inline const float* getCubicInterpolationBuffer() { return sample_buffer_.data.get(); }
 
   protected:
-    FileSourceKeyframe compute_frame_;
-    WaveSourceKeyframe interpolate_from_frame_;
-    WaveSourceKeyframe interpolate_to_frame_;
+    class FileSourceScratch : public RenderScratch {
+      public:
+        FileSourceScratch(SampleBuffer* sample_buffer) : RenderScratch(new FileSourceKeyframe(sample_buffer)) { }
+
+        WaveSourceKeyframe interpolate_from_frame;
+        WaveSourceKeyframe interpolate_to_frame;
+    };
 
     SampleBuffer sample_buffer_;
     float overridden_phase_[vital::WaveFrame::kWaveformSize];
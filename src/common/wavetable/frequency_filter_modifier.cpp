@@ -118,11 +118,16 @@ WavetableKeyframe* FrequencyFilterModifier::createKeyframe(int position) {
   return keyframe;
 }
 
-void FrequencyFilterModifier::render(vital::WaveFrame* wave_frame, float position) {
-  interpolate(&compute_frame_, position);
-  compute_frame_.setStyle(style_);
-  compute_frame_.setNormalize(normalize_);
-  compute_frame_.render(wave_frame);
+std::unique_ptr<WavetableComponent::RenderScratch> FrequencyFilterModifier::createRenderScratch() {
+  return std::make_unique<RenderScratch>(new FrequencyFilterModifierKeyframe());
+}
+
+void FrequencyFilterModifier::renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) {
+  FrequencyFilterModifierKeyframe* compute_frame = static_cast<FrequencyFilterModifierKeyframe*>(scratch->compute_frame.get());
+  interpolate(compute_frame, position);
+  compute_frame->setStyle(style_);
+  compute_frame->setNormalize(normalize_);
+  compute_frame->render(wave_frame);
 }
 
 WavetableComponentFactory::ComponentType FrequencyFilterModifier::getType() {
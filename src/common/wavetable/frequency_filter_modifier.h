@@ -64,7 +64,8 @@ class FrequencyFilterModifier : public WavetableComponent {
       virtual ~FrequencyFilterModifier() { }
 
       virtual WavetableKeyframe* createKeyframe(int position) override;
-      virtual void render(vital::WaveFrame* wave_frame, float position) override;
+      virtual std::unique_ptr<RenderScratch> createRenderScratch() override;
+      virtual void renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) override;
       virtual WavetableComponentFactory::ComponentType getType() override;
       virtual json stateToJson() override;
       virtual void jsonToState(json data) override;
@@ -80,7 +81,6 @@ class FrequencyFilterModifier : public WavetableComponent {
     protected:
       FilterStyle style_;
       bool normalize_;
-      FrequencyFilterModifierKeyframe compute_frame_;
 
       JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FrequencyFilterModifier)
 };
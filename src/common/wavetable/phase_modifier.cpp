@@ -100,10 +100,15 @@ WavetableKeyframe* PhaseModifier::createKeyframe(int position) {
   return keyframe;
 }
 
-void PhaseModifier::render(vital::WaveFrame* wave_frame, float position) {
-  compute_frame_.setPhaseStyle(phase_style_);
-  interpolate(&compute_frame_, position);
-  compute_frame_.render(wave_frame);
+std::unique_ptr<WavetableComponent::RenderScratch> PhaseModifier::createRenderScratch() {
+  return std::make_unique<RenderScratch>(new PhaseModifierKeyframe());
+}
+
+void PhaseModifier::renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) {
+  PhaseModifierKeyframe* compute_frame = static_cast<PhaseModifierKeyframe*>(scratch->compute_frame.get());
+  compute_frame->setPhaseStyle(phase_style_);
+  interpolate(compute_frame, position);
+  compute_frame->render(wave_frame);
 }
 
 WavetableComponentFactory::ComponentType PhaseModifier::getType() {
@@ -60,7 +60,8 @@ class PhaseModifier : public WavetableComponent {
     virtual ~PhaseModifier() = default;
 
     virtual WavetableKeyframe* createKeyframe(int position) override;
-    virtual void render(vital::WaveFrame* wave_frame, float position) override;
+    virtual std::unique_ptr<RenderScratch> createRenderScratch() override;
+    virtual void renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) override;
     virtual WavetableComponentFactory::ComponentType getType() override;
     virtual json stateToJson() override;
     virtual void jsonToState(json data) override;
@@ -71,7 +72,6 @@ class PhaseModifier : public WavetableComponent {
     PhaseStyle getPhaseStyle() const { return phase_style_; }
 
   protected:
-    PhaseModifierKeyframe compute_frame_;
     PhaseStyle phase_style_;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PhaseModifier)
@@ -101,3 +101,42 @@ float PitchDetector::findYinPeriod(int max_period) {
 float PitchDetector::matchPeriod(int max_period) {
   return findYinPeriod(max_period);
 }
+
+float PitchDetector::findPeriod(int min_period, int max_period, float threshold) {
+  min_period = std::max(min_period, 2);
+  int window = size_ - max_period;
+  if (window <= 1 || max_period <= min_period)
+    return 0.0f;
+
+  difference_.resize(max_period + 2);
+  difference_[0] = 1.0f;
+  float running_total = 0.0f;
+  for (int period = 1; period <= max_period + 1; ++period) {
+    float difference = 0.0f;
+    int length = std::min(window, size_ - period);
+    for (int i = 0; i < length; ++i) {
+      float delta = signal_data_[i] - signal_data_[i + period];
+      difference += delta * delta;
+    }
+
+    running_total += difference;
+    difference_[period] = running_total > 0.0f ? difference * period / running_total : 1.0f;
+  }
+
+  int period = min_period;
+  while (period < max_period && difference_[period] >= threshold)
+    period++;
+  if (difference_[period] >= threshold)
+    return 0.0f;
+
+  while (period < max_period && difference_[period + 1] < difference_[period])
+    period++;
+
+  float before = difference_[period - 1];
+  float center = difference_[period];
+  float after = difference_[period + 1];
+  float curvature = before - 2.0f * center + after;
+  if (curvature <= 0.0f)
+    return period;
+  return period + 0.5f * (before - after) / curvature;
+}
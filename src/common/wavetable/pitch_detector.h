@@ -21,6 +21,7 @@
 class PitchDetector {
   public:
     static constexpr int kNumPoints = 2520;
+    static constexpr float kDefaultYinThreshold = 0.15f;
 
     PitchDetector();
 
@@ -30,12 +31,16 @@ class PitchDetector {
     float getPeriodError(float period);
     float findYinPeriod(int max_period);
     float matchPeriod(int max_period);
+    // Period from the YIN cumulative mean normalized difference, searched between _min_period_ and
+    // _max_period_ samples. Returns 0 when no period dips under _threshold_, e.g. for noise or silence.
+    float findPeriod(int min_period, int max_period, float threshold = kDefaultYinThreshold);
 
     const float* data() const { return signal_data_.get(); }
 
   protected:
     int size_;
     std::unique_ptr<float[]> signal_data_;
+    std::vector<float> difference_;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PitchDetector)
 };
@@ -17,19 +17,23 @@
 #include "shepard_tone_source.h"
 #include "wavetable_component_factory.h"
 
-ShepardToneSource::ShepardToneSource() {
-  loop_frame_ = std::make_unique<WaveSourceKeyframe>();
-}
+ShepardToneSource::ShepardToneSource() { }
 
 ShepardToneSource::~ShepardToneSource() { }
 
-void ShepardToneSource::render(vital::WaveFrame* wave_frame, float position) {
+std::unique_ptr<WavetableComponent::RenderScratch> ShepardToneSource::createRenderScratch() {
+  return std::make_unique<ShepardToneScratch>();
+}
+
+void ShepardToneSource::renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) {
   if (numFrames() == 0)
     return;
 
+  ShepardToneScratch* shepard_scratch = static_cast<ShepardToneScratch*>(scratch);
+  WaveSourceKeyframe* compute_frame = static_cast<WaveSourceKeyframe*>(scratch->compute_frame.get());
   WaveSourceKeyframe* keyframe = getKeyframe(0);
   vital::WaveFrame* key_wave_frame = keyframe->wave_frame();
-  vital::WaveFrame* loop_wave_frame = loop_frame_->wave_frame();
+  vital::WaveFrame* loop_wave_frame = shepard_scratch->loop_frame.wave_frame();
 
   for (int i = 0; i < vital::WaveFrame::kWaveformSize / 2; ++i) {
     loop_wave_frame->frequency_domain[i * 2] = key_wave_frame->frequency_domain[i];
@@ -38,9 +42,9 @@ void ShepardToneSource::render(vital::WaveFrame* wave_frame, float position) {
 
   loop_wave_frame->toTimeDomain();
 
-  compute_frame_->setInterpolationMode(interpolation_mode_);
-  compute_frame_->interpolate(keyframe, loop_frame_.get(), position / (vital::kNumOscillatorWaveFrames - 1.0f));
-  wave_frame->copy(compute_frame_->wave_frame());
+  compute_frame->setInterpolationMode(interpolation_mode_);
+  compute_frame->interpolate(keyframe, &shepard_scratch->loop_frame, position / (vital::kNumOscillatorWaveFrames - 1.0f));
+  wave_frame->copy(compute_frame->wave_frame());
 }
 
 WavetableComponentFactory::ComponentType ShepardToneSource::getType() {
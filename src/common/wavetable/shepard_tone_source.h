@@ -24,12 +24,18 @@ class ShepardToneSource : public WaveSource {
     ShepardToneSource();
     virtual ~ShepardToneSource();
 
-    virtual void render(vital::WaveFrame* wave_frame, float position) override;
+    virtual std::unique_ptr<RenderScratch> createRenderScratch() override;
+    virtual void renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) override;
     virtual WavetableComponentFactory::ComponentType getType() override;
     virtual bool hasKeyframes() override { return false; }
 
   protected: 
-    std::unique_ptr<WaveSourceKeyframe> loop_frame_;
+    class ShepardToneScratch : public RenderScratch {
+      public:
+        ShepardToneScratch() : RenderScratch(new WaveSourceKeyframe()) { }
+
+        WaveSourceKeyframe loop_frame;
+    };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ShepardToneSource)
 };
\ No newline at end of file
@@ -79,9 +79,14 @@ WavetableKeyframe* SlewLimitModifier::createKeyframe(int position) {
   return keyframe;
 }
 
-void SlewLimitModifier::render(vital::WaveFrame* wave_frame, float position) {
-  interpolate(&compute_frame_, position);
-  compute_frame_.render(wave_frame);
+std::unique_ptr<WavetableComponent::RenderScratch> SlewLimitModifier::createRenderScratch() {
+  return std::make_unique<RenderScratch>(new SlewLimitModifierKeyframe());
+}
+
+void SlewLimitModifier::renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) {
+  SlewLimitModifierKeyframe* compute_frame = static_cast<SlewLimitModifierKeyframe*>(scratch->compute_frame.get());
+  interpolate(compute_frame, position);
+  compute_frame->render(wave_frame);
 }
 
 WavetableComponentFactory::ComponentType SlewLimitModifier::getType() {
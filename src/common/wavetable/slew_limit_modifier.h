@@ -50,14 +50,12 @@ class SlewLimitModifier : public WavetableComponent {
     virtual ~SlewLimitModifier() { }
 
     virtual WavetableKeyframe* createKeyframe(int position) override;
-    virtual void render(vital::WaveFrame* wave_frame, float position) override;
+    virtual std::unique_ptr<RenderScratch> createRenderScratch() override;
+    virtual void renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) override;
     virtual WavetableComponentFactory::ComponentType getType() override;
 
     SlewLimitModifierKeyframe* getKeyframe(int index);
 
-  protected:
-    SlewLimitModifierKeyframe compute_frame_;
-
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SlewLimitModifier)
 };
 
@@ -66,9 +66,14 @@ WavetableKeyframe* WaveFoldModifier::createKeyframe(int position) {
   return keyframe;
 }
 
-void WaveFoldModifier::render(vital::WaveFrame* wave_frame, float position) {
-  interpolate(&compute_frame_, position);
-  compute_frame_.render(wave_frame);
+std::unique_ptr<WavetableComponent::RenderScratch> WaveFoldModifier::createRenderScratch() {
+  return std::make_unique<RenderScratch>(new WaveFoldModifierKeyframe());
+}
+
+void WaveFoldModifier::renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) {
+  WaveFoldModifierKeyframe* compute_frame = static_cast<WaveFoldModifierKeyframe*>(scratch->compute_frame.get());
+  interpolate(compute_frame, position);
+  compute_frame->render(wave_frame);
 }
 
 WavetableComponentFactory::ComponentType WaveFoldModifier::getType() {
@@ -46,14 +46,12 @@ class WaveFoldModifier : public WavetableComponent {
     virtual ~WaveFoldModifier() { }
 
     virtual WavetableKeyframe* createKeyframe(int position) override;
-    virtual void render(vital::WaveFrame* wave_frame, float position) override;
+    virtual std::unique_ptr<RenderScratch> createRenderScratch() override;
+    virtual void renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) override;
     virtual WavetableComponentFactory::ComponentType getType() override;
 
     WaveFoldModifierKeyframe* getKeyframe(int index);
 
-  protected:
-    WaveFoldModifierKeyframe compute_frame_;
-
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WaveFoldModifier)
 };
 
@@ -96,9 +96,14 @@ WavetableKeyframe* WaveLineSource::createKeyframe(int position) {
   return keyframe;
 }
 
-void WaveLineSource::render(vital::WaveFrame* wave_frame, float position) {
-  interpolate(&compute_frame_, position);
-  compute_frame_.render(wave_frame);
+std::unique_ptr<WavetableComponent::RenderScratch> WaveLineSource::createRenderScratch() {
+  return std::make_unique<RenderScratch>(new WaveLineSourceKeyframe());
+}
+
+void WaveLineSource::renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) {
+  WaveLineSourceKeyframe* compute_frame = static_cast<WaveLineSourceKeyframe*>(scratch->compute_frame.get());
+  interpolate(compute_frame, position);
+  compute_frame->render(wave_frame);
 }
 
 WavetableComponentFactory::ComponentType WaveLineSource::getType() {
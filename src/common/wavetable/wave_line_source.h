@@ -56,11 +56,12 @@ class WaveLineSource : public WavetableComponent {
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WaveLineSourceKeyframe)
     };
 
-    WaveLineSource() : num_points_(kDefaultLinePoints), compute_frame_() { }
+    WaveLineSource() : num_points_(kDefaultLinePoints) { }
     virtual ~WaveLineSource() = default;
 
     virtual WavetableKeyframe* createKeyframe(int position) override;
-    virtual void render(vital::WaveFrame* wave_frame, float position) override;
+    virtual std::unique_ptr<RenderScratch> createRenderScratch() override;
+    virtual void renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) override;
     virtual WavetableComponentFactory::ComponentType getType() override;
     virtual json stateToJson() override;
     virtual void jsonToState(json data) override;
@@ -71,7 +72,6 @@ class WaveLineSource : public WavetableComponent {
 
   protected:
     int num_points_;
-    WaveLineSourceKeyframe compute_frame_;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WaveLineSource)
 };
@@ -15,11 +15,11 @@
  */
 
 #include "wave_source.h"
+#include "audio_block.h"
 #include "wave_frame.h"
 #include "wavetable_component_factory.h"
 
 WaveSource::WaveSource() {
-  compute_frame_ = std::make_unique<WaveSourceKeyframe>();
   interpolation_mode_ = kFrequency;
 }
 
@@ -31,10 +31,15 @@ WavetableKeyframe* WaveSource::createKeyframe(int position) {
   return keyframe;
 }
 
-void WaveSource::render(vital::WaveFrame* wave_frame, float position) {
-  compute_frame_->setInterpolationMode(interpolation_mode_);
-  interpolate(compute_frame_.get(), position);
-  wave_frame->copy(compute_frame_->wave_frame());
+std::unique_ptr<WavetableComponent::RenderScratch> WaveSource::createRenderScratch() {
+  return std::make_unique<RenderScratch>(new WaveSourceKeyframe());
+}
+
+void WaveSource::renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) {
+  WaveSourceKeyframe* compute_frame = static_cast<WaveSourceKeyframe*>(scratch->compute_frame.get());
+  compute_frame->setInterpolationMode(interpolation_mode_);
+  interpolate(compute_frame, position);
+  wave_frame->copy(compute_frame->wave_frame());
 }
 
 WavetableComponentFactory::ComponentType WaveSource::getType() {
@@ -50,7 +55,6 @@ json WaveSource::stateToJson() {
 void WaveSource::jsonToState(json data) {
   WavetableComponent::jsonToState(data);
   interpolation_mode_ = data["interpolation"];
-  compute_frame_->setInterpolationMode(interpolation_mode_);
 }
 
 vital::WaveFrame* WaveSource::getWaveFrame(int index) {
@@ -200,9 +204,7 @@ json WaveSourceKeyframe::stateToJson() {
 void WaveSourceKeyframe::jsonToState(json data) {
   WavetableKeyframe::jsonToState(data);
 
-  MemoryOutputStream decoded(sizeof(float) * vital::WaveFrame::kWaveformSize);
-  std::string wave_data = data["wave_data"];
-  Base64::convertFromBase64(decoded, wave_data);
-  memcpy(wave_frame_->time_domain, decoded.getData(), sizeof(float) * vital::WaveFrame::kWaveformSize);
+  vital::audio_block::copy(data["wave_data"], wave_frame_->time_domain,
+                           sizeof(float) * vital::WaveFrame::kWaveformSize);
   wave_frame_->toFrequencyDomain();
 }
\ No newline at end of file
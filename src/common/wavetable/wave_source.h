@@ -33,7 +33,8 @@ class WaveSource : public WavetableComponent {
     virtual ~WaveSource();
 
     virtual WavetableKeyframe* createKeyframe(int position) override;
-    virtual void render(vital::WaveFrame* wave_frame, float position) override;
+    virtual std::unique_ptr<RenderScratch> createRenderScratch() override;
+    virtual void renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) override;
     virtual WavetableComponentFactory::ComponentType getType() override;
     virtual json stateToJson() override;
     virtual void jsonToState(json data) override;
@@ -45,7 +46,6 @@ class WaveSource : public WavetableComponent {
     InterpolationMode getInterpolationMode() const { return interpolation_mode_; }
 
   protected:
-    std::unique_ptr<WaveSourceKeyframe> compute_frame_;
     InterpolationMode interpolation_mode_;
  
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WaveSource)
@@ -106,11 +106,16 @@ WavetableKeyframe* WaveWarpModifier::createKeyframe(int position) {
   return keyframe;
 }
 
-void WaveWarpModifier::render(vital::WaveFrame* wave_frame, float position) {
-  interpolate(&compute_frame_, position);
-  compute_frame_.setHorizontalAsymmetric(horizontal_asymmetric_);
-  compute_frame_.setVerticalAsymmetric(vertical_asymmetric_);
-  compute_frame_.render(wave_frame);
+std::unique_ptr<WavetableComponent::RenderScratch> WaveWarpModifier::createRenderScratch() {
+  return std::make_unique<RenderScratch>(new WaveWarpModifierKeyframe());
+}
+
+void WaveWarpModifier::renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) {
+  WaveWarpModifierKeyframe* compute_frame = static_cast<WaveWarpModifierKeyframe*>(scratch->compute_frame.get());
+  interpolate(compute_frame, position);
+  compute_frame->setHorizontalAsymmetric(horizontal_asymmetric_);
+  compute_frame->setVerticalAsymmetric(vertical_asymmetric_);
+  compute_frame->render(wave_frame);
 }
 
 WavetableComponentFactory::ComponentType WaveWarpModifier::getType() {
@@ -56,7 +56,8 @@ class WaveWarpModifier : public WavetableComponent {
     virtual ~WaveWarpModifier() = default;
 
     virtual WavetableKeyframe* createKeyframe(int position) override;
-    virtual void render(vital::WaveFrame* wave_frame, float position) override;
+    virtual std::unique_ptr<RenderScratch> createRenderScratch() override;
+    virtual void renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) override;
     virtual WavetableComponentFactory::ComponentType getType() override;
     virtual json stateToJson() override;
     virtual void jsonToState(json data) override;
@@ -70,7 +71,6 @@ class WaveWarpModifier : public WavetableComponent {
     WaveWarpModifierKeyframe* getKeyframe(int index);
 
   protected:
-    WaveWarpModifierKeyframe compute_frame_;
     bool horizontal_asymmetric_;
     bool vertical_asymmetric_;
 
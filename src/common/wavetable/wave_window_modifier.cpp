@@ -93,10 +93,15 @@ WavetableKeyframe* WaveWindowModifier::createKeyframe(int position) {
   return keyframe;
 }
 
-void WaveWindowModifier::render(vital::WaveFrame* wave_frame, float position) {
-  interpolate(&compute_frame_, position);
-  compute_frame_.setWindowShape(window_shape_);
-  compute_frame_.render(wave_frame);
+std::unique_ptr<WavetableComponent::RenderScratch> WaveWindowModifier::createRenderScratch() {
+  return std::make_unique<RenderScratch>(new WaveWindowModifierKeyframe());
+}
+
+void WaveWindowModifier::renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) {
+  WaveWindowModifierKeyframe* compute_frame = static_cast<WaveWindowModifierKeyframe*>(scratch->compute_frame.get());
+  interpolate(compute_frame, position);
+  compute_frame->setWindowShape(window_shape_);
+  compute_frame->render(wave_frame);
 }
 
 WavetableComponentFactory::ComponentType WaveWindowModifier::getType() {
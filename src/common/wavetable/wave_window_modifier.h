@@ -65,7 +65,8 @@ class WaveWindowModifier : public WavetableComponent {
     virtual ~WaveWindowModifier() { }
 
     virtual WavetableKeyframe* createKeyframe(int position) override;
-    virtual void render(vital::WaveFrame* wave_frame, float position) override;
+    virtual std::unique_ptr<RenderScratch> createRenderScratch() override;
+    virtual void renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) override;
     virtual WavetableComponentFactory::ComponentType getType() override;
     virtual json stateToJson() override;
     virtual void jsonToState(json data) override;
@@ -76,7 +77,6 @@ class WaveWindowModifier : public WavetableComponent {
     WindowShape getWindowShape() { return window_shape_; }
 
   protected:
-    WaveWindowModifierKeyframe compute_frame_;
     WindowShape window_shape_;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WaveWindowModifier)
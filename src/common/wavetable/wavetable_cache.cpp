@@ -0,0 +1,130 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "wavetable_cache.h"
+#include "audio_block.h"
+
+#include <functional>
+
+namespace {
+  // Block references only hold an address, which a later preset can reuse for different audio,
+  // so the key takes their bytes instead.
+  void detachBlocks(json& value, std::string& blocks) {
+    if (vital::audio_block::isReference(value)) {
+      MemoryOutputStream decoded;
+      size_t size = 0;
+      const void* data = vital::audio_block::read(value, decoded, size);
+      blocks.append(static_cast<const char*>(data), size);
+      value = size;
+    }
+    else if (value.is_structured()) {
+      for (json& child : value)
+        detachBlocks(child, blocks);
+    }
+  }
+} // namespace
+
+WavetableCache::WavetableCache() : capacity_(kDefaultCapacity), hits_(0), misses_(0) { }
+
+WavetableCache::~WavetableCache() {
+  clearSingletonInstance();
+}
+
+JUCE_IMPLEMENT_SINGLETON(WavetableCache)
+
+WavetableCache::Key WavetableCache::keyForJson(const json& data) {
+  json detached = data;
+  std::string blocks;
+  detachBlocks(detached, blocks);
+
+  Key key;
+  key.text = detached.dump() + blocks;
+  key.hash = std::hash<std::string>()(key.text);
+  return key;
+}
+
+bool WavetableCache::load(const Key& key, vital::Wavetable* wavetable) {
+  bool shepard = false;
+  std::shared_ptr<const vital::Wavetable::WavetableData> data;
+  {
+    ScopedLock lock(lock_);
+    auto found = lookup_.find(key.hash);
+    if (found == lookup_.end() || found->second->key.text != key.text) {
+      misses_++;
+      return false;
+    }
+
+    hits_++;
+    entries_.splice(entries_.begin(), entries_, found->second);
+    shepard = found->second->shepard;
+    data = found->second->data;
+  }
+
+  // Every wavetable loaded from this entry uses the same tables until one of them changes its own.
+  wavetable->loadSharedData(data);
+  wavetable->setShepardTable(shepard);
+  return true;
+}
+
+void WavetableCache::store(const Key& key, const vital::Wavetable* wavetable) {
+  {
+    ScopedLock lock(lock_);
+    if (capacity_ <= 0)
+      return;
+  }
+
+  Entry entry;
+  entry.key = key;
+  entry.shepard = wavetable->isShepardTable();
+  entry.data = wavetable->shareData();
+
+  ScopedLock lock(lock_);
+  auto found = lookup_.find(key.hash);
+  if (found != lookup_.end()) {
+    entries_.erase(found->second);
+    lookup_.erase(found);
+  }
+
+  entries_.push_front(entry);
+  lookup_[key.hash] = entries_.begin();
+  trim();
+}
+
+void WavetableCache::setCapacity(int capacity) {
+  ScopedLock lock(lock_);
+  capacity_ = std::max(0, capacity);
+  trim();
+}
+
+void WavetableCache::clear() {
+  ScopedLock lock(lock_);
+  entries_.clear();
+  lookup_.clear();
+  hits_ = 0;
+  misses_ = 0;
+}
+
+WavetableCache::Stats WavetableCache::getStats() {
+  ScopedLock lock(lock_);
+  return { static_cast<int>(entries_.size()), capacity_, hits_, misses_ };
+}
+
+void WavetableCache::trim() {
+  while (static_cast<int>(entries_.size()) > capacity_) {
+    lookup_.erase(entries_.back().key.hash);
+    entries_.pop_back();
+  }
+}
@@ -0,0 +1,81 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "json/json.h"
+#include "wavetable.h"
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+using json = nlohmann::json;
+
+// Process wide LRU cache of rendered wavetables keyed by the wavetable json. Entries keep the full key
+// text so a hash collision is a miss rather than the wrong wavetable.
+// Lets preset loads skip WavetableCreator::render when the same wavetable was rendered before.
+// Cached tables aren't copied. Every synth that loads the same wavetable shares one read-only block,
+// which stays alive until the last synth changes or drops it, even after it leaves the cache.
+class WavetableCache : public DeletedAtShutdown {
+  public:
+    static constexpr int kDefaultCapacity = 32;
+
+    struct Stats {
+      int size;
+      int capacity;
+      int64 hits;
+      int64 misses;
+    };
+
+    struct Key {
+      size_t hash;
+      std::string text;
+    };
+
+    WavetableCache();
+    virtual ~WavetableCache();
+
+    static Key keyForJson(const json& data);
+
+    // Points _wavetable_ at the cached tables and returns true if _key_ is cached.
+    bool load(const Key& key, vital::Wavetable* wavetable);
+    void store(const Key& key, const vital::Wavetable* wavetable);
+
+    void setCapacity(int capacity);
+    void clear();
+    Stats getStats();
+
+    JUCE_DECLARE_SINGLETON(WavetableCache, false)
+
+  private:
+    struct Entry {
+      Key key;
+      bool shepard;
+      std::shared_ptr<const vital::Wavetable::WavetableData> data;
+    };
+
+    void trim();
+
+    CriticalSection lock_;
+    std::list<Entry> entries_;
+    std::unordered_map<size_t, std::list<Entry>::iterator> lookup_;
+    int capacity_;
+    int64 hits_;
+    int64 misses_;
+};
@@ -25,24 +25,47 @@ WavetableKeyframe* WavetableComponent::insertNewKeyframe(int position) {
 
   int index = getIndexFromPosition(position);
   keyframes_.insert(keyframes_.begin() + index, std::unique_ptr<WavetableKeyframe>(keyframe));
+  markDirty(keyframe);
   return keyframe;
 }
 
 void WavetableComponent::reposition(WavetableKeyframe* keyframe) {
+  markDirty(keyframe);
   int start_index = indexOf(keyframe);
   keyframes_[start_index].release();
   keyframes_.erase(keyframes_.begin() + start_index);
 
   int new_index = getIndexFromPosition(keyframe->position());
   keyframes_.insert(keyframes_.begin() + new_index, std::unique_ptr<WavetableKeyframe>(keyframe));
+  markDirty(keyframe);
 }
 
 void WavetableComponent::remove(WavetableKeyframe* keyframe) {
+  markDirty(keyframe);
   int start_index = indexOf(keyframe);
   keyframes_.erase(keyframes_.begin() + start_index);
 }
 
+void WavetableComponent::markDirty(WavetableKeyframe* keyframe) {
+  int index = indexOf(keyframe);
+  if (index < 0) {
+    markDirty();
+    return;
+  }
+
+  // A keyframe shapes the frames up to its neighbors, and cubic interpolation reaches one keyframe further.
+  int reach = interpolation_style_ == kCubic ? 2 : 1;
+  int start = 0;
+  if (index - reach >= 0)
+    start = keyframes_[index - reach]->position();
+  int end = vital::kNumOscillatorWaveFrames - 1;
+  if (index + reach < numFrames())
+    end = keyframes_[index + reach]->position();
+  markDirty(start, end);
+}
+
 void WavetableComponent::jsonToState(json data) {
+  markDirty();
   keyframes_.clear();
   for (json json_keyframe : data["keyframes"]) {
     WavetableKeyframe* keyframe = insertNewKeyframe(json_keyframe["position"]);
@@ -65,7 +88,14 @@ json WavetableComponent::stateToJson() {
   };
 }
 
+void WavetableComponent::render(vital::WaveFrame* wave_frame, float position) {
+  if (scratch_ == nullptr)
+    scratch_ = createRenderScratch();
+  renderFrame(wave_frame, position, scratch_.get());
+}
+
 void WavetableComponent::reset() {
+  markDirty();
   keyframes_.clear();
   insertNewKeyframe(0);
 }
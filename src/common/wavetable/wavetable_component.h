@@ -36,17 +36,31 @@ class WavetableComponent {
       kNumInterpolationStyles
     };
 
-    WavetableComponent() : interpolation_style_(kLinear) { }
+    // Working keyframes for rendering. A component keeps one for render(wave_frame, position) and
+    // threads rendering the same component at once each bring their own from createRenderScratch().
+    class RenderScratch {
+      public:
+        RenderScratch(WavetableKeyframe* frame) : compute_frame(frame) { }
+        virtual ~RenderScratch() { }
+
+        std::unique_ptr<WavetableKeyframe> compute_frame;
+    };
+
+    WavetableComponent() : interpolation_style_(kLinear), dirty_start_(vital::kNumOscillatorWaveFrames),
+                           dirty_end_(-1) { }
     virtual ~WavetableComponent() { }
 
     virtual WavetableKeyframe* createKeyframe(int position) = 0;
-    virtual void render(vital::WaveFrame* wave_frame, float position) = 0;
+    virtual std::unique_ptr<RenderScratch> createRenderScratch() = 0;
+    // Must only write to _wave_frame_ and _scratch_ so frames can render in parallel.
+    virtual void renderFrame(vital::WaveFrame* wave_frame, float position, RenderScratch* scratch) = 0;
     virtual WavetableComponentFactory::ComponentType getType() = 0;
     virtual json stateToJson();
     virtual void jsonToState(json data);
     virtual void prerender() { }
     virtual bool hasKeyframes() { return true; }
 
+    void render(vital::WaveFrame* wave_frame, float position);
     void reset();
     void interpolate(WavetableKeyframe* dest, float position);
     WavetableKeyframe* insertNewKeyframe(int position);
@@ -66,12 +80,35 @@ class WavetableComponent {
     WavetableKeyframe* getFrameAtPosition(int position);
     int getLastKeyframePosition();
 
-    void setInterpolationStyle(InterpolationStyle type) { interpolation_style_ = type; }
+    void setInterpolationStyle(InterpolationStyle type) {
+      interpolation_style_ = type;
+      markDirty();
+    }
     InterpolationStyle getInterpolationStyle() const { return interpolation_style_; }
+
+    // Frames that need rendering again since the last clearDirty(). Keyframes mark their own range when
+    // added, moved or removed. Callers changing a keyframe's settings mark it with markDirty(keyframe),
+    // and callers changing settings of the whole component call markDirty().
+    void markDirty(int start, int end) {
+      dirty_start_ = std::min(dirty_start_, start);
+      dirty_end_ = std::max(dirty_end_, end);
+    }
+    void markDirty() { markDirty(0, vital::kNumOscillatorWaveFrames - 1); }
+    void markDirty(WavetableKeyframe* keyframe);
+    void clearDirty() {
+      dirty_start_ = vital::kNumOscillatorWaveFrames;
+      dirty_end_ = -1;
+    }
+    bool isDirty() const { return dirty_start_ <= dirty_end_; }
+    int getDirtyStart() const { return dirty_start_; }
+    int getDirtyEnd() const { return dirty_end_; }
   
   protected:
     std::vector<std::unique_ptr<WavetableKeyframe>> keyframes_;
     InterpolationStyle interpolation_style_;
+    int dirty_start_;
+    int dirty_end_;
+    std::unique_ptr<RenderScratch> scratch_;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WavetableComponent)
 };
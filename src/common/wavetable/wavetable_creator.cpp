@@ -23,6 +23,9 @@
 #include "wave_source.h"
 #include "wavetable.h"
 
+#include <atomic>
+#include <thread>
+
 namespace {
   int getFirstNonZeroSample(const float* audio_buffer, int num_samples) {
     for (int i = 0; i < num_samples; ++i) {
@@ -46,6 +49,7 @@ void WavetableCreator::moveUp(int index) {
     return;
   
   groups_[index].swap(groups_[index - 1]);
+  unprocessed_data_.reset();
 }
 
 void WavetableCreator::moveDown(int index) {
@@ -53,6 +57,7 @@ void WavetableCreator::moveDown(int index) {
     return;
 
   groups_[index].swap(groups_[index + 1]);
+  unprocessed_data_.reset();
 }
 
 void WavetableCreator::removeGroup(int index) {
@@ -61,36 +66,66 @@ void WavetableCreator::removeGroup(int index) {
 
   std::unique_ptr<WavetableGroup> group = std::move(groups_[index]);
   groups_.erase(groups_.begin() + index);
+  unprocessed_data_.reset();
 }
 
 float WavetableCreator::render(int position) {
-  compute_frame_combine_.clear();
-  compute_frame_combine_.index = position;
-  compute_frame_.index = position;
+  return render(position, &compute_frame_, &compute_frame_combine_, nullptr);
+}
 
-  for (auto& group : groups_) {
-    group->render(&compute_frame_, position);
-    compute_frame_combine_.addFrom(&compute_frame_);
+float WavetableCreator::render(int position, vital::WaveFrame* compute_frame,
+                               vital::WaveFrame* compute_frame_combine,
+                               const std::vector<WavetableGroup::RenderScratch>* group_scratch) {
+  compute_frame_combine->clear();
+  compute_frame_combine->index = position;
+  compute_frame->index = position;
+
+  for (int i = 0; i < groups_.size(); ++i) {
+    if (group_scratch)
+      groups_[i]->render(compute_frame, position, group_scratch->at(i));
+    else
+      groups_[i]->render(compute_frame, position);
+    compute_frame_combine->addFrom(compute_frame);
   }
 
   if (groups_.size() > 1)
-    compute_frame_combine_.multiply(1.0f / groups_.size());
+    compute_frame_combine->multiply(1.0f / groups_.size());
 
   if (remove_all_dc_)
-    compute_frame_combine_.removedDc();
+    compute_frame_combine->removedDc();
 
   float max_value = 0.0f;
   float min_value = 0.0f;
   for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i) {
-    max_value = std::max(compute_frame_combine_.time_domain[i], max_value);
-    min_value = std::min(compute_frame_combine_.time_domain[i], min_value);
+    max_value = std::max(compute_frame_combine->time_domain[i], max_value);
+    min_value = std::min(compute_frame_combine->time_domain[i], min_value);
   }
 
-  wavetable_->loadWaveFrame(&compute_frame_combine_);
+  wavetable_->loadWaveFrame(compute_frame_combine);
   return max_value - min_value;
 }
 
-void WavetableCreator::render() {
+void WavetableCreator::renderParallel(int start, int end) {
+  int num_threads = std::min(render_threads_, end - start);
+  std::atomic<int> next_frame(start);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&]() {
+      std::unique_ptr<RenderScratch> scratch = std::make_unique<RenderScratch>();
+      for (auto& group : groups_)
+        scratch->groups.push_back(group->createRenderScratch());
+
+      for (int i = next_frame++; i < end; i = next_frame++)
+        frame_spans_[i] = render(i, &scratch->compute_frame, &scratch->compute_frame_combine, &scratch->groups);
+    });
+  }
+
+  for (std::thread& thread : threads)
+    thread.join();
+}
+
+int WavetableCreator::prerender() {
   int last_waveframe = 0;
   bool shepard = groups_.size() > 0;
   for (auto& group : groups_) {
@@ -98,16 +133,65 @@ void WavetableCreator::render() {
     last_waveframe = std::max(last_waveframe, group->getLastKeyframePosition());
     shepard = shepard && group->isShepardTone();
   }
-  
-  wavetable_->setNumFrames(last_waveframe + 1);
+
   wavetable_->setShepardTable(shepard);
-  float max_span = 0.0f;
-  for (int i = 0; i < last_waveframe + 1; ++i)
-    max_span = std::max(render(i), max_span);
+  return last_waveframe;
+}
+
+float WavetableCreator::renderFrames(int start, int end) {
+  if (render_threads_ > 1 && end - start > 1) {
+    // The ends render here: the first makes the table private before threads write into it and the
+    // last leaves its frequency ratio and sample rate in compute_frame_ as a serial render would.
+    frame_spans_[start] = render(start);
+    renderParallel(start + 1, end);
+    frame_spans_[end] = render(end);
+  }
+  else {
+    for (int i = start; i <= end; ++i)
+      frame_spans_[i] = render(i);
+  }
+
   wavetable_->setFrequencyRatio(compute_frame_.frequency_ratio);
   wavetable_->setSampleRate(compute_frame_.sample_rate);
+  if (keep_unprocessed_)
+    unprocessed_data_ = wavetable_->copyData();
 
-  postRender(max_span);
+  for (auto& group : groups_)
+    group->clearDirty();
+  return *std::max_element(frame_spans_.begin(), frame_spans_.end());
+}
+
+void WavetableCreator::render() {
+  int last_waveframe = prerender();
+  wavetable_->setNumFrames(last_waveframe + 1);
+  frame_spans_.assign(last_waveframe + 1, 0.0f);
+  postRender(renderFrames(0, last_waveframe));
+}
+
+int WavetableCreator::renderDirty() {
+  keep_unprocessed_ = true;
+  int last_waveframe = prerender();
+  if (unprocessed_data_ == nullptr || unprocessed_data_->num_frames != last_waveframe + 1) {
+    render();
+    return last_waveframe + 1;
+  }
+
+  int start = vital::kNumOscillatorWaveFrames;
+  int end = -1;
+  for (auto& group : groups_) {
+    start = std::min(start, group->getDirtyStart());
+    end = std::max(end, group->getDirtyEnd());
+  }
+  end = std::min(end, last_waveframe);
+  if (start > end) {
+    for (auto& group : groups_)
+      group->clearDirty();
+    return 0;
+  }
+
+  wavetable_->loadData(unprocessed_data_.get());
+  postRender(renderFrames(start, end));
+  return end - start + 1;
 }
 
 void WavetableCreator::postRender(float max_span) {
@@ -157,6 +241,7 @@ void WavetableCreator::init() {
 
 void WavetableCreator::clear() {
   groups_.clear();
+  unprocessed_data_.reset();
   remove_all_dc_ = true;
   full_normalize_ = true;
 }
@@ -286,6 +371,11 @@ void WavetableCreator::initFromPitchedAudioFile(const float* audio_buffer, int n
 }
 
 void WavetableCreator::initFromLineGenerator(LineGenerator* line_generator) {
+  loadLineGenerator(line_generator);
+  render();
+}
+
+void WavetableCreator::loadLineGenerator(LineGenerator* line_generator) {
   clear();
 
   wavetable_->setName(line_generator->getName());
@@ -298,7 +388,6 @@ void WavetableCreator::initFromLineGenerator(LineGenerator* line_generator) {
 
   new_group->addComponent(line_source);
   addGroup(new_group);
-  render();
 }
 
 bool WavetableCreator::isValidJson(json data) {
@@ -478,10 +567,15 @@ json WavetableCreator::stateToJson() {
 }
 
 void WavetableCreator::jsonToState(json data) {
+  jsonToGroups(data);
+  render();
+}
+
+void WavetableCreator::jsonToGroups(json data) {
   if (LineGenerator::isValidJson(data)) {
     LineGenerator generator(vital::WaveFrame::kWaveformSize);
     generator.jsonToState(data);
-    initFromLineGenerator(&generator);
+    loadLineGenerator(&generator);
     return;
   }
 
@@ -511,6 +605,4 @@ void WavetableCreator::jsonToState(json data) {
     new_group->jsonToState(json_group);
     addGroup(new_group);
   }
-
-  render();
 }
@@ -38,11 +38,15 @@ class WavetableCreator {
       kNumDragLoadStyles
     };
 
-    WavetableCreator(vital::Wavetable* wavetable) : wavetable_(wavetable),
-                                                    full_normalize_(true), remove_all_dc_(true) { }
+    WavetableCreator(vital::Wavetable* wavetable) : wavetable_(wavetable), full_normalize_(true),
+                                                    remove_all_dc_(true), render_threads_(1),
+                                                    keep_unprocessed_(false) { }
   
     int getGroupIndex(WavetableGroup* group);
-    void addGroup(WavetableGroup* group) { groups_.push_back(std::unique_ptr<WavetableGroup>(group)); }
+    void addGroup(WavetableGroup* group) {
+      groups_.push_back(std::unique_ptr<WavetableGroup>(group));
+      unprocessed_data_.reset();
+    }
     void removeGroup(int index);
     void moveUp(int index);
     void moveDown(int index);
@@ -51,8 +55,16 @@ class WavetableCreator {
     WavetableGroup* getGroup(int index) const { return groups_[index].get(); }
     float render(int position);
     void render();
+    // Renders only the frames the groups marked dirty since the last render and returns how many
+    // frames it rendered. The first call renders everything and from then on the creator keeps a copy
+    // of the frames from before normalization to render on top of.
+    int renderDirty();
     void postRender(float max_span);
     void renderToBuffer(float* buffer, int num_frames, int frame_size);
+    // render() spreads frames over this many threads. Each thread renders into its own scratch frames,
+    // so the result is the same as a single threaded render.
+    void setRenderThreads(int num_threads) { render_threads_ = std::max(1, num_threads); }
+    int getRenderThreads() const { return render_threads_; }
     void init();
     void clear();
     void loadDefaultCreator();
@@ -72,6 +84,8 @@ class WavetableCreator {
     json updateJson(json data);
     json stateToJson();
     void jsonToState(json data);
+    // Same as jsonToState but leaves the wavetable unrendered.
+    void jsonToGroups(json data);
 
     vital::Wavetable* getWavetable() { return wavetable_; }
 
@@ -81,15 +95,32 @@ class WavetableCreator {
     void initFromVocodedAudioFile(const float* audio_buffer, int num_samples, int sample_rate, bool ttwt);
     void initFromPitchedAudioFile(const float* audio_buffer, int num_samples, int sample_rate);
     void initFromLineGenerator(LineGenerator* line_generator);
+    void loadLineGenerator(LineGenerator* line_generator);
+
+    struct RenderScratch {
+      vital::WaveFrame compute_frame;
+      vital::WaveFrame compute_frame_combine;
+      std::vector<WavetableGroup::RenderScratch> groups;
+    };
+
+    float render(int position, vital::WaveFrame* compute_frame, vital::WaveFrame* compute_frame_combine,
+                 const std::vector<WavetableGroup::RenderScratch>* group_scratch);
+    int prerender();
+    float renderFrames(int start, int end);
+    void renderParallel(int start, int end);
 
     vital::WaveFrame compute_frame_combine_;
     vital::WaveFrame compute_frame_;
     std::vector<std::unique_ptr<WavetableGroup>> groups_;
+    std::vector<float> frame_spans_;
+    std::unique_ptr<vital::Wavetable::WavetableData> unprocessed_data_;
 
     std::string last_file_loaded_;
     vital::Wavetable* wavetable_;
     bool full_normalize_;
     bool remove_all_dc_;
+    int render_threads_;
+    bool keep_unprocessed_;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WavetableCreator)
 };
@@ -33,6 +33,7 @@ void WavetableGroup::moveUp(int index) {
     return;
 
   components_[index].swap(components_[index - 1]);
+  dirty_ = true;
 }
 
 void WavetableGroup::moveDown(int index) {
@@ -40,6 +41,7 @@ void WavetableGroup::moveDown(int index) {
     return;
 
   components_[index].swap(components_[index + 1]);
+  dirty_ = true;
 }
 
 void WavetableGroup::removeComponent(int index) {
@@ -48,10 +50,12 @@ void WavetableGroup::removeComponent(int index) {
 
   std::unique_ptr<WavetableComponent> component = std::move(components_[index]);
   components_.erase(components_.begin() + index);
+  dirty_ = true;
 }
 
 void WavetableGroup::reset() {
   components_.clear();
+  dirty_ = true;
   loadDefaultGroup();
 }
 
@@ -76,6 +80,20 @@ void WavetableGroup::render(vital::WaveFrame* wave_frame, float position) const
     component->render(wave_frame, position);
 }
 
+void WavetableGroup::render(vital::WaveFrame* wave_frame, float position, const RenderScratch& scratch) const {
+  wave_frame->index = position;
+
+  for (int i = 0; i < components_.size(); ++i)
+    components_[i]->renderFrame(wave_frame, position, scratch[i].get());
+}
+
+WavetableGroup::RenderScratch WavetableGroup::createRenderScratch() const {
+  RenderScratch scratch;
+  for (auto& component : components_)
+    scratch.push_back(component->createRenderScratch());
+  return scratch;
+}
+
 void WavetableGroup::renderTo(vital::Wavetable* wavetable) {
   for (int i = 0; i < vital::kNumOscillatorWaveFrames; ++i) {
     compute_frame_.index = i;
@@ -121,6 +139,7 @@ json WavetableGroup::stateToJson() {
 
 void WavetableGroup::jsonToState(json data) {
   components_.clear();
+  dirty_ = true;
 
   json json_components = data["components"];
   for (json json_component : json_components) {
@@ -130,3 +149,33 @@ void WavetableGroup::jsonToState(json data) {
     addComponent(component);
   }
 }
+
+void WavetableGroup::clearDirty() {
+  dirty_ = false;
+  for (auto& component : components_)
+    component->clearDirty();
+}
+
+bool WavetableGroup::isDirty() const {
+  return getDirtyStart() <= getDirtyEnd();
+}
+
+int WavetableGroup::getDirtyStart() const {
+  if (dirty_)
+    return 0;
+
+  int start = vital::kNumOscillatorWaveFrames;
+  for (auto& component : components_)
+    start = std::min(start, component->getDirtyStart());
+  return start;
+}
+
+int WavetableGroup::getDirtyEnd() const {
+  if (dirty_)
+    return vital::kNumOscillatorWaveFrames - 1;
+
+  int end = -1;
+  for (auto& component : components_)
+    end = std::max(end, component->getDirtyEnd());
+  return end;
+}
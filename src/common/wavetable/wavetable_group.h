@@ -26,11 +26,15 @@ namespace vital {
 
 class WavetableGroup {
   public:
-    WavetableGroup() { }
+    // Scratch for each component, so threads can render different frames of the group at once.
+    typedef std::vector<std::unique_ptr<WavetableComponent::RenderScratch>> RenderScratch;
+
+    WavetableGroup() : dirty_(false) { }
 
     int getComponentIndex(WavetableComponent* component);
     void addComponent(WavetableComponent* component) {
       components_.push_back(std::unique_ptr< WavetableComponent>(component));
+      dirty_ = true;
     }
     void removeComponent(int index);
     void moveUp(int index);
@@ -42,6 +46,8 @@ class WavetableGroup {
     WavetableComponent* getComponent(int index) const { return components_[index].get(); }
     bool isShepardTone();
     void render(vital::WaveFrame* wave_frame, float position) const;
+    void render(vital::WaveFrame* wave_frame, float position, const RenderScratch& scratch) const;
+    RenderScratch createRenderScratch() const;
     void renderTo(vital::Wavetable* wavetable);
     void loadDefaultGroup();
     int getLastKeyframePosition();
@@ -49,9 +55,18 @@ class WavetableGroup {
     json stateToJson();
     void jsonToState(json data);
 
+    // Frames the components need rendering again. Adding, removing or reordering components
+    // dirties every frame.
+    void markDirty() { dirty_ = true; }
+    void clearDirty();
+    bool isDirty() const;
+    int getDirtyStart() const;
+    int getDirtyEnd() const;
+
   protected:
     vital::WaveFrame compute_frame_;
     std::vector<std::unique_ptr<WavetableComponent>> components_;
+    bool dirty_;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WavetableGroup)
 };
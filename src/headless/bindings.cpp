@@ -4,12 +4,21 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <atomic>
 #include <cmath>
 #include <stdexcept>
+#include <system_error>
+#include <thread>
 
+#include "batch_renderer.h"
+#include "binary_preset.h"
 #include "compressor.h"
+#include "feature_extractor.h"
 #include "processor_router.h"
 #include "random_lfo.h"
+#include "render_stream.h"
+#include "sweep_renderer.h"
 #include "sound_engine.h"
 #include "synth_base.h"
 #include "synth_filter.h"
@@ -18,6 +27,7 @@
 #include "value.h"
 #include "voice_handler.h"
 #include "wave_frame.h"
+#include "wavetable_cache.h"
 #include "synth_parameters.h"
 
 using namespace vital;
@@ -64,6 +74,88 @@ static std::string GetControlText(HeadlessSynth &synth, const std::string &name)
     return std::to_string(display_val) + details.display_units;
 }
 
+// Converts a 0-1 normalized position into the raw value for a control with _details_
+static float NormalizedToValue(const ValueDetails &details, double normalized) {
+    normalized = std::max(0.0, std::min(1.0, normalized));
+    
+    float value;
+    
+    if (details.value_scale == ValueDetails::kIndexed) {
+        int num_options = static_cast<int>(details.max - details.min + 1);
+        int index = static_cast<int>(std::round(normalized * (num_options - 1)));
+        value = details.min + index;
+    } else {
+        float value_normalized = static_cast<float>(normalized);
+        
+        switch (details.value_scale) {
+        case ValueDetails::kQuadratic:
+            value = details.min + std::sqrt(value_normalized) * (details.max - details.min);
+            break;
+        case ValueDetails::kCubic:
+            value = details.min + std::pow(value_normalized, 1.0f/3.0f) * (details.max - details.min);
+            break;
+        case ValueDetails::kQuartic:
+            value = details.min + value_normalized * (details.max - details.min);
+            break;
+        case ValueDetails::kExponential:
+            if (details.display_invert)
+                value = details.min + (1.0f / std::pow(2.0f, value_normalized)) * (details.max - details.min);
+            else
+                value = details.min + std::pow(2.0f, value_normalized) * (details.max - details.min);
+            break;
+        case ValueDetails::kSquareRoot:
+            value = details.min + (value_normalized * value_normalized) * (details.max - details.min);
+            break;
+        default:
+            value = details.min + value_normalized * (details.max - details.min);
+            break;
+        }
+    }
+    return value;
+}
+
+static float NormalizedToValue(const std::string &name, double normalized) {
+    return NormalizedToValue(Parameters::getDetails(name), normalized);
+}
+
+// The reverse of NormalizedToValue, clamped to 0-1
+static double ValueToNormalized(const ValueDetails &details, float raw) {
+    double normalized;
+    if (details.value_scale == ValueDetails::kIndexed) {
+        int num_options = static_cast<int>(details.max - details.min + 1);
+        int index = static_cast<int>(std::round(raw - details.min));
+        normalized = static_cast<double>(index) / (num_options - 1);
+    } else {
+        float normalized_internal = (raw - details.min) / (details.max - details.min);
+        
+        switch (details.value_scale) {
+        case ValueDetails::kQuadratic:
+            normalized = normalized_internal * normalized_internal;
+            break;
+        case ValueDetails::kCubic:
+            normalized = normalized_internal * normalized_internal * normalized_internal;
+            break;
+        case ValueDetails::kQuartic:
+            normalized = normalized_internal;
+            break;
+        case ValueDetails::kExponential:
+            if (details.display_invert)
+                normalized = -std::log2(normalized_internal + 1e-10f);
+            else
+                normalized = std::log2(normalized_internal + 1e-10f);
+            break;
+        case ValueDetails::kSquareRoot:
+            normalized = std::sqrt(normalized_internal);
+            break;
+        default:
+            normalized = normalized_internal;
+            break;
+        }
+    }
+    
+    return std::max(0.0, std::min(1.0, normalized));
+}
+
 // Cache for modulation sources and destinations
 class ModulationListCache {
 private:
@@ -136,6 +228,7 @@ public:
     void Initialize(vital::Value* value, const std::string& name, HeadlessSynth* synth) {
         value_ = value;
         name_ = name;
+        details_ = &Parameters::getDetails(name);
         synth_ = synth;
     }
     
@@ -145,6 +238,7 @@ public:
 private:
     vital::Value* value_;
     std::string name_;
+    const ValueDetails* details_;
     HeadlessSynth* synth_;
     
     Napi::Value GetValue(const Napi::CallbackInfo& info) {
@@ -169,84 +263,11 @@ private:
         }
         
         double normalized = info[0].As<Napi::Number>().DoubleValue();
-        normalized = std::max(0.0, std::min(1.0, normalized));
-        
-        const auto &details = Parameters::getDetails(name_);
-        float value;
-        
-        if (details.value_scale == ValueDetails::kIndexed) {
-            int num_options = static_cast<int>(details.max - details.min + 1);
-            int index = static_cast<int>(std::round(normalized * (num_options - 1)));
-            value = details.min + index;
-        } else {
-            float value_normalized = static_cast<float>(normalized);
-            
-            switch (details.value_scale) {
-            case ValueDetails::kQuadratic:
-                value = details.min + std::sqrt(value_normalized) * (details.max - details.min);
-                break;
-            case ValueDetails::kCubic:
-                value = details.min + std::pow(value_normalized, 1.0f/3.0f) * (details.max - details.min);
-                break;
-            case ValueDetails::kQuartic:
-                value = details.min + value_normalized * (details.max - details.min);
-                break;
-            case ValueDetails::kExponential:
-                if (details.display_invert)
-                    value = details.min + (1.0f / std::pow(2.0f, value_normalized)) * (details.max - details.min);
-                else
-                    value = details.min + std::pow(2.0f, value_normalized) * (details.max - details.min);
-                break;
-            case ValueDetails::kSquareRoot:
-                value = details.min + (value_normalized * value_normalized) * (details.max - details.min);
-                break;
-            default:
-                value = details.min + value_normalized * (details.max - details.min);
-                break;
-            }
-        }
-        
-        value_->set(value);
+        value_->set(NormalizedToValue(*details_, normalized));
     }
     
     Napi::Value GetNormalized(const Napi::CallbackInfo& info) {
-        const auto &details = Parameters::getDetails(name_);
-        float raw = value_->value();
-        
-        double normalized;
-        if (details.value_scale == ValueDetails::kIndexed) {
-            int num_options = static_cast<int>(details.max - details.min + 1);
-            int index = static_cast<int>(std::round(raw - details.min));
-            normalized = static_cast<double>(index) / (num_options - 1);
-        } else {
-            float normalized_internal = (raw - details.min) / (details.max - details.min);
-            
-            switch (details.value_scale) {
-            case ValueDetails::kQuadratic:
-                normalized = normalized_internal * normalized_internal;
-                break;
-            case ValueDetails::kCubic:
-                normalized = normalized_internal * normalized_internal * normalized_internal;
-                break;
-            case ValueDetails::kQuartic:
-                normalized = normalized_internal;
-                break;
-            case ValueDetails::kExponential:
-                if (details.display_invert)
-                    normalized = -std::log2(normalized_internal + 1e-10f);
-                else
-                    normalized = std::log2(normalized_internal + 1e-10f);
-                break;
-            case ValueDetails::kSquareRoot:
-                normalized = std::sqrt(normalized_internal);
-                break;
-            default:
-                normalized = normalized_internal;
-                break;
-            }
-        }
-        
-        return Napi::Number::New(info.Env(), std::max(0.0, std::min(1.0, normalized)));
+        return Napi::Number::New(info.Env(), ValueToNormalized(*details_, value_->value()));
     }
     
     Napi::Value GetText(const Napi::CallbackInfo& info) {
@@ -256,6 +277,677 @@ private:
 
 Napi::FunctionReference ControlValueWrapper::constructor;
 
+// Wraps rendered audio in a Buffer that takes ownership of the native allocation.
+// The data is freed by the finalizer when the Buffer is garbage collected.
+static Napi::Buffer<float> ExternalAudioBuffer(Napi::Env env, const VitalAudioBuffer& audio_data) {
+    return Napi::Buffer<float>::New(env, audio_data.data, audio_data.size,
+                                    [](Napi::Env, float* data) { delete[] data; });
+}
+
+// Moves _values_ into a Float32Array without copying them.
+static Napi::Float32Array ExternalFloat32Array(Napi::Env env, std::vector<float>& values) {
+    if (values.empty())
+        return Napi::Float32Array::New(env, 0);
+
+    std::vector<float>* data = new std::vector<float>(std::move(values));
+    Napi::ArrayBuffer buffer = Napi::ArrayBuffer::New(env, data->data(), data->size() * sizeof(float),
+                                                      [](Napi::Env, void*, std::vector<float>* hint) { delete hint; },
+                                                      data);
+    return Napi::Float32Array::New(env, data->size(), buffer, 0);
+}
+
+// What renders with features return instead of the bare audio:
+// { audio, frames, sampleRate, fftSize, hopSize, bins, spectrogram, melBands, mel, rms, pitch }
+// with only the features that were asked for. Takes ownership of _audio_data_.
+static Napi::Object FeatureResult(Napi::Env env, VitalAudioBuffer& audio_data, FeatureExtractor& extractor) {
+    const FeatureOptions& options = extractor.getOptions();
+    FeatureExtractor::Features& features = extractor.getFeatures();
+
+    Napi::Object result = Napi::Object::New(env);
+    if (options.audio)
+        result.Set("audio", ExternalAudioBuffer(env, audio_data));
+    else
+        delete[] audio_data.data;
+    audio_data.data = nullptr;
+
+    result.Set("frames", features.num_frames);
+    result.Set("sampleRate", extractor.getSampleRate());
+    result.Set("fftSize", options.fft_size);
+    result.Set("hopSize", options.hop_size);
+    if (options.spectrogram) {
+        result.Set("bins", extractor.getNumBins());
+        result.Set("spectrogram", ExternalFloat32Array(env, features.spectrogram));
+    }
+    if (options.mel) {
+        result.Set("melBands", options.mel_bands);
+        result.Set("mel", ExternalFloat32Array(env, features.mel));
+    }
+    if (options.rms)
+        result.Set("rms", ExternalFloat32Array(env, features.rms));
+    if (options.pitch)
+        result.Set("pitch", ExternalFloat32Array(env, features.pitch));
+    return result;
+}
+
+// Copies a JS array or typed array of numbers.
+template <typename T>
+static bool ReadNumberList(const Napi::Value& value, std::vector<T>& output) {
+    if (value.IsTypedArray()) {
+        Napi::TypedArray typed_array = value.As<Napi::TypedArray>();
+        if (typed_array.TypedArrayType() == napi_float32_array) {
+            Napi::Float32Array floats = value.As<Napi::Float32Array>();
+            output.assign(floats.Data(), floats.Data() + floats.ElementLength());
+            return true;
+        }
+        if (typed_array.TypedArrayType() == napi_float64_array) {
+            Napi::Float64Array doubles = value.As<Napi::Float64Array>();
+            output.assign(doubles.Data(), doubles.Data() + doubles.ElementLength());
+            return true;
+        }
+        return false;
+    }
+
+    if (!value.IsArray())
+        return false;
+
+    Napi::Array array = value.As<Napi::Array>();
+    output.resize(array.Length());
+    for (uint32_t i = 0; i < array.Length(); ++i) {
+        Napi::Value element = array.Get(i);
+        if (!element.IsNumber())
+            return false;
+        output[i] = static_cast<T>(element.As<Napi::Number>().DoubleValue());
+    }
+    return true;
+}
+
+// Reads one lane: { name, values, times | rate, normalized }.
+// Without times the values are evenly spaced at _rate_ values per second.
+static bool ReadAutomationLane(Napi::Env env, const Napi::Value& value, AutomationLane& lane) {
+    if (!value.IsObject()) {
+        Napi::TypeError::New(env, "Automation lane objects expected").ThrowAsJavaScriptException();
+        return false;
+    }
+    Napi::Object object = value.As<Napi::Object>();
+
+    Napi::Value name = object.Get("name");
+    if (!name.IsString() || !Parameters::isParameter(name.As<Napi::String>().Utf8Value())) {
+        Napi::TypeError::New(env, "Automation lane needs a valid control name").ThrowAsJavaScriptException();
+        return false;
+    }
+    lane.name = name.As<Napi::String>().Utf8Value();
+
+    if (!ReadNumberList(object.Get("values"), lane.values) || lane.values.empty()) {
+        Napi::TypeError::New(env, "Automation lane for " + lane.name + " needs values").ThrowAsJavaScriptException();
+        return false;
+    }
+
+    Napi::Value times = object.Get("times");
+    Napi::Value rate = object.Get("rate");
+    if (!times.IsUndefined()) {
+        if (!ReadNumberList(times, lane.times) || lane.times.size() != lane.values.size() ||
+            !std::is_sorted(lane.times.begin(), lane.times.end())) {
+            Napi::TypeError::New(env, "Automation times for " + lane.name +
+                                 " must be ascending and match values").ThrowAsJavaScriptException();
+            return false;
+        }
+    }
+    else if (rate.IsNumber() && rate.As<Napi::Number>().DoubleValue() > 0.0) {
+        double seconds_per_value = 1.0 / rate.As<Napi::Number>().DoubleValue();
+        lane.times.resize(lane.values.size());
+        for (size_t i = 0; i < lane.times.size(); ++i)
+            lane.times[i] = i * seconds_per_value;
+    }
+    else {
+        Napi::TypeError::New(env, "Automation lane for " + lane.name + " needs times or rate").ThrowAsJavaScriptException();
+        return false;
+    }
+
+    if (object.Get("normalized").ToBoolean().Value()) {
+        for (vital::mono_float& lane_value : lane.values)
+            lane_value = NormalizedToValue(lane.name, lane_value);
+    }
+    return true;
+}
+
+// Reads { spectrogram, mel, rms, pitch, audio, fftSize, hopSize, melBands, minPitch, maxPitch } into _options_.
+// Throws and returns false on bad values.
+static bool ReadFeatureOptions(Napi::Env env, const Napi::Value& value, FeatureOptions& options) {
+    if (!value.IsObject()) {
+        Napi::TypeError::New(env, "features must be an object").ThrowAsJavaScriptException();
+        return false;
+    }
+    Napi::Object object = value.As<Napi::Object>();
+
+    Napi::Value spectrogram = object.Get("spectrogram");
+    Napi::Value mel = object.Get("mel");
+    Napi::Value rms = object.Get("rms");
+    Napi::Value pitch = object.Get("pitch");
+    Napi::Value audio = object.Get("audio");
+    for (const Napi::Value& flag : { spectrogram, mel, rms, pitch, audio }) {
+        if (!flag.IsUndefined() && !flag.IsBoolean()) {
+            Napi::TypeError::New(env, "Feature flags must be booleans").ThrowAsJavaScriptException();
+            return false;
+        }
+    }
+    if (spectrogram.IsBoolean())
+        options.spectrogram = spectrogram.As<Napi::Boolean>().Value();
+    if (mel.IsBoolean())
+        options.mel = mel.As<Napi::Boolean>().Value();
+    if (rms.IsBoolean())
+        options.rms = rms.As<Napi::Boolean>().Value();
+    if (pitch.IsBoolean())
+        options.pitch = pitch.As<Napi::Boolean>().Value();
+    if (audio.IsBoolean())
+        options.audio = audio.As<Napi::Boolean>().Value();
+
+    Napi::Value fft_size = object.Get("fftSize");
+    Napi::Value hop_size = object.Get("hopSize");
+    Napi::Value mel_bands = object.Get("melBands");
+    Napi::Value min_pitch = object.Get("minPitch");
+    Napi::Value max_pitch = object.Get("maxPitch");
+    for (const Napi::Value& number : { fft_size, hop_size, mel_bands, min_pitch, max_pitch }) {
+        if (!number.IsUndefined() && !number.IsNumber()) {
+            Napi::TypeError::New(env, "Feature options must be numbers").ThrowAsJavaScriptException();
+            return false;
+        }
+    }
+    if (fft_size.IsNumber())
+        options.fft_size = fft_size.As<Napi::Number>().Int32Value();
+    if (hop_size.IsNumber())
+        options.hop_size = hop_size.As<Napi::Number>().Int32Value();
+    if (mel_bands.IsNumber())
+        options.mel_bands = mel_bands.As<Napi::Number>().Int32Value();
+    if (min_pitch.IsNumber())
+        options.min_pitch = min_pitch.As<Napi::Number>().FloatValue();
+    if (max_pitch.IsNumber())
+        options.max_pitch = max_pitch.As<Napi::Number>().FloatValue();
+
+    if (!FeatureOptions::isValidFftSize(options.fft_size)) {
+        Napi::RangeError::New(env, "fftSize must be a power of two between " +
+                              std::to_string(FeatureOptions::kMinFftSize) + " and " +
+                              std::to_string(FeatureOptions::kMaxFftSize)).ThrowAsJavaScriptException();
+        return false;
+    }
+    if (options.hop_size < 1) {
+        Napi::RangeError::New(env, "hopSize must be at least 1").ThrowAsJavaScriptException();
+        return false;
+    }
+    if (options.mel_bands < 1 || options.mel_bands > options.fft_size / 2) {
+        Napi::RangeError::New(env, "melBands must be between 1 and fftSize / 2").ThrowAsJavaScriptException();
+        return false;
+    }
+    if (options.min_pitch <= 0.0f || options.max_pitch <= options.min_pitch) {
+        Napi::RangeError::New(env, "minPitch must be above 0 and below maxPitch").ThrowAsJavaScriptException();
+        return false;
+    }
+    return true;
+}
+
+// Reads { sampleRate, blockSize, bitDepth, lean, pipelined, stopOnSilence, silenceThreshold, silenceHold, seed, features, automation } into _options_, keeping defaults for missing keys.
+// Throws and returns false on bad values.
+static bool ReadRenderOptions(Napi::Env env, const Napi::Object& object, RenderOptions& options) {
+    Napi::Value sample_rate = object.Get("sampleRate");
+    Napi::Value block_size = object.Get("blockSize");
+    Napi::Value bit_depth = object.Get("bitDepth");
+    if ((!sample_rate.IsUndefined() && !sample_rate.IsNumber()) ||
+        (!block_size.IsUndefined() && !block_size.IsNumber()) ||
+        (!bit_depth.IsUndefined() && !bit_depth.IsNumber())) {
+        Napi::TypeError::New(env, "Render options must be numbers").ThrowAsJavaScriptException();
+        return false;
+    }
+
+    if (sample_rate.IsNumber())
+        options.sample_rate = sample_rate.As<Napi::Number>().Int32Value();
+    if (block_size.IsNumber())
+        options.block_size = block_size.As<Napi::Number>().Int32Value();
+    if (bit_depth.IsNumber())
+        options.bit_depth = bit_depth.As<Napi::Number>().Int32Value();
+
+    if (!RenderOptions::isValidSampleRate(options.sample_rate)) {
+        Napi::RangeError::New(env, "sampleRate must be between " + std::to_string(RenderOptions::kMinSampleRate) +
+                              " and " + std::to_string(RenderOptions::kMaxSampleRate)).ThrowAsJavaScriptException();
+        return false;
+    }
+    if (!RenderOptions::isValidBlockSize(options.block_size)) {
+        Napi::RangeError::New(env, "blockSize must be between 1 and " +
+                              std::to_string(vital::kMaxBufferSize)).ThrowAsJavaScriptException();
+        return false;
+    }
+    if (!RenderOptions::isValidBitDepth(options.bit_depth)) {
+        Napi::RangeError::New(env, "bitDepth must be 16, 24 or 32").ThrowAsJavaScriptException();
+        return false;
+    }
+
+    Napi::Value lean = object.Get("lean");
+    Napi::Value pipelined = object.Get("pipelined");
+    if ((!lean.IsUndefined() && !lean.IsBoolean()) || (!pipelined.IsUndefined() && !pipelined.IsBoolean())) {
+        Napi::TypeError::New(env, "lean and pipelined must be booleans").ThrowAsJavaScriptException();
+        return false;
+    }
+    if (lean.IsBoolean())
+        options.lean = lean.As<Napi::Boolean>().Value();
+    if (pipelined.IsBoolean())
+        options.pipelined = pipelined.As<Napi::Boolean>().Value();
+
+    Napi::Value stop_on_silence = object.Get("stopOnSilence");
+    Napi::Value silence_threshold = object.Get("silenceThreshold");
+    Napi::Value silence_hold = object.Get("silenceHold");
+    if (!stop_on_silence.IsUndefined() && !stop_on_silence.IsBoolean()) {
+        Napi::TypeError::New(env, "stopOnSilence must be a boolean").ThrowAsJavaScriptException();
+        return false;
+    }
+    if ((!silence_threshold.IsUndefined() && !silence_threshold.IsNumber()) ||
+        (!silence_hold.IsUndefined() && !silence_hold.IsNumber())) {
+        Napi::TypeError::New(env, "Render options must be numbers").ThrowAsJavaScriptException();
+        return false;
+    }
+    if (stop_on_silence.IsBoolean())
+        options.stop_on_silence = stop_on_silence.As<Napi::Boolean>().Value();
+    if (silence_threshold.IsNumber())
+        options.silence_threshold_db = silence_threshold.As<Napi::Number>().FloatValue();
+    if (silence_hold.IsNumber())
+        options.silence_hold = silence_hold.As<Napi::Number>().FloatValue();
+    if (options.silence_hold < 0.0f) {
+        Napi::RangeError::New(env, "silenceHold can't be negative").ThrowAsJavaScriptException();
+        return false;
+    }
+
+    Napi::Value seed = object.Get("seed");
+    if (!seed.IsUndefined()) {
+        if (!seed.IsNumber()) {
+            Napi::TypeError::New(env, "seed must be a number").ThrowAsJavaScriptException();
+            return false;
+        }
+        options.seeded = true;
+        options.seed = seed.As<Napi::Number>().Int32Value();
+    }
+
+    Napi::Value features = object.Get("features");
+    if (!features.IsUndefined() && !ReadFeatureOptions(env, features, options.features))
+        return false;
+
+    Napi::Value automation = object.Get("automation");
+    if (automation.IsUndefined())
+        return true;
+    if (!automation.IsArray()) {
+        Napi::TypeError::New(env, "automation must be an array of lanes").ThrowAsJavaScriptException();
+        return false;
+    }
+
+    Napi::Array lanes = automation.As<Napi::Array>();
+    options.automation.resize(lanes.Length());
+    for (uint32_t i = 0; i < lanes.Length(); ++i) {
+        if (!ReadAutomationLane(env, lanes.Get(i), options.automation[i]))
+            return false;
+    }
+    return true;
+}
+
+// Optional trailing options argument shared by the render methods.
+static bool GetRenderOptions(const Napi::CallbackInfo& info, size_t index, RenderOptions& options) {
+    if (info.Length() <= index || info[index].IsUndefined())
+        return true;
+    if (!info[index].IsObject()) {
+        Napi::TypeError::New(info.Env(), "Render options object expected").ThrowAsJavaScriptException();
+        return false;
+    }
+    return ReadRenderOptions(info.Env(), info[index].As<Napi::Object>(), options);
+}
+
+// Only render(), renderAsync() and renderSequence() can hand features back, so the other render methods
+// throw rather than quietly drop them. Returns false after throwing.
+static bool RejectFeatures(Napi::Env env, const RenderOptions& options) {
+    if (!options.features.enabled())
+        return true;
+    Napi::TypeError::New(env, "features are only returned by render, renderAsync and renderSequence")
+        .ThrowAsJavaScriptException();
+    return false;
+}
+
+static bool ReadEventType(const std::string& name, RenderEvent::Type& type) {
+    static const std::map<std::string, RenderEvent::Type> kEventTypes = {
+        { "noteOn", RenderEvent::kNoteOn },
+        { "noteOff", RenderEvent::kNoteOff },
+        { "pitchBend", RenderEvent::kPitchBend },
+        { "modWheel", RenderEvent::kModWheel },
+        { "aftertouch", RenderEvent::kAftertouch },
+        { "channelPressure", RenderEvent::kChannelPressure }
+    };
+    auto found = kEventTypes.find(name);
+    if (found == kEventTypes.end())
+        return false;
+    type = found->second;
+    return true;
+}
+
+// Fills _sequence_ from either a Standard MIDI File path or an array of event objects:
+// { type, time | sample, note, velocity, value, channel }. Times are in seconds, channels are 1-16.
+// Throws and returns false on bad input.
+static bool ReadRenderSequence(Napi::Env env, const Napi::Value& value, const RenderOptions& options,
+                               RenderSequence& sequence) {
+    if (value.IsString()) {
+        std::string error;
+        if (!sequence.loadMidiFile(File(value.As<Napi::String>().Utf8Value()), options.sample_rate, error)) {
+            Napi::Error::New(env, error).ThrowAsJavaScriptException();
+            return false;
+        }
+        sequence.sort();
+        return true;
+    }
+
+    if (!value.IsArray()) {
+        Napi::TypeError::New(env, "Array of events or MIDI file path expected").ThrowAsJavaScriptException();
+        return false;
+    }
+
+    Napi::Array js_events = value.As<Napi::Array>();
+    for (uint32_t i = 0; i < js_events.Length(); ++i) {
+        Napi::Value js_value = js_events.Get(i);
+        if (!js_value.IsObject()) {
+            Napi::TypeError::New(env, "Event objects expected").ThrowAsJavaScriptException();
+            return false;
+        }
+        Napi::Object js_event = js_value.As<Napi::Object>();
+
+        RenderEvent event;
+        Napi::Value type = js_event.Get("type");
+        if (!type.IsString() || !ReadEventType(type.As<Napi::String>().Utf8Value(), event.type)) {
+            Napi::TypeError::New(env, "Unknown event type at index " + std::to_string(i)).ThrowAsJavaScriptException();
+            return false;
+        }
+
+        Napi::Value sample = js_event.Get("sample");
+        Napi::Value time = js_event.Get("time");
+        if (sample.IsNumber())
+            event.sample = sample.As<Napi::Number>().Int32Value();
+        else if (time.IsNumber())
+            event.sample = static_cast<int>(std::round(time.As<Napi::Number>().DoubleValue() * options.sample_rate));
+        else {
+            Napi::TypeError::New(env, "Event needs a time or sample at index " + std::to_string(i)).ThrowAsJavaScriptException();
+            return false;
+        }
+
+        Napi::Value channel = js_event.Get("channel");
+        if (channel.IsNumber())
+            event.channel = std::max(0, std::min(channel.As<Napi::Number>().Int32Value() - 1, vital::kNumMidiChannels - 1));
+
+        Napi::Value note = js_event.Get("note");
+        if (note.IsNumber())
+            event.note = note.As<Napi::Number>().Int32Value();
+
+        Napi::Value velocity = js_event.Get("velocity");
+        Napi::Value event_value = js_event.Get("value");
+        if (event.type == RenderEvent::kNoteOn)
+            event.value = velocity.IsNumber() ? velocity.As<Napi::Number>().FloatValue() : 0.7f;
+        else if (event.type == RenderEvent::kNoteOff)
+            event.value = velocity.IsNumber() ? velocity.As<Napi::Number>().FloatValue() : 0.5f;
+        else if (event_value.IsNumber())
+            event.value = event_value.As<Napi::Number>().FloatValue();
+
+        sequence.add(event);
+    }
+    sequence.sort();
+    return true;
+}
+
+// Base for renders that run on a libuv pool thread and settle a Promise.
+// Holds a reference to the owning JS Synth so it can't be collected mid-render.
+// The render itself takes the HeadlessSynth critical section, so overlapping
+// calls on the same synth run one after another.
+class SynthAsyncWorker : public Napi::AsyncWorker {
+public:
+    SynthAsyncWorker(Napi::Env env, Napi::Object owner, HeadlessSynth* synth)
+        : Napi::AsyncWorker(env), deferred_(Napi::Promise::Deferred::New(env)), synth_(synth) {
+        owner_ = Napi::Persistent(owner);
+    }
+
+    Napi::Promise GetPromise() { return deferred_.Promise(); }
+
+protected:
+    void OnError(const Napi::Error& error) override {
+        deferred_.Reject(error.Value());
+    }
+
+    Napi::Promise::Deferred deferred_;
+    Napi::ObjectReference owner_;
+    HeadlessSynth* synth_;
+};
+
+class RenderWorker : public SynthAsyncWorker {
+public:
+    RenderWorker(Napi::Env env, Napi::Object owner, HeadlessSynth* synth,
+                 int midi_note, double midi_velocity, double note_dur, double render_dur,
+                 const RenderOptions& options)
+        : SynthAsyncWorker(env, owner, synth), midi_note_(midi_note), midi_velocity_(midi_velocity),
+          note_dur_(note_dur), render_dur_(render_dur), options_(options), audio_data_() {
+        if (options_.features.enabled())
+            features_ = std::make_unique<FeatureExtractor>(options_.features, options_.sample_rate);
+    }
+
+    ~RenderWorker() {
+        delete[] audio_data_.data;
+    }
+
+protected:
+    void Execute() override {
+        try {
+            audio_data_ = synth_->renderAudioToNumpy(midi_note_, midi_velocity_, note_dur_, render_dur_, options_,
+                                                     features_.get());
+        } catch (const std::exception& e) {
+            SetError(e.what());
+        }
+    }
+
+    void OnOK() override {
+        if (features_)
+            deferred_.Resolve(FeatureResult(Env(), audio_data_, *features_));
+        else
+            deferred_.Resolve(ExternalAudioBuffer(Env(), audio_data_));
+        audio_data_.data = nullptr;
+    }
+
+private:
+    int midi_note_;
+    double midi_velocity_;
+    double note_dur_;
+    double render_dur_;
+    RenderOptions options_;
+    VitalAudioBuffer audio_data_;
+    std::unique_ptr<FeatureExtractor> features_;
+};
+
+class RenderFileWorker : public SynthAsyncWorker {
+public:
+    RenderFileWorker(Napi::Env env, Napi::Object owner, HeadlessSynth* synth, const std::string& output_path,
+                     int midi_note, double midi_velocity, double note_dur, double render_dur,
+                     const RenderOptions& options)
+        : SynthAsyncWorker(env, owner, synth), output_path_(output_path), midi_note_(midi_note),
+          midi_velocity_(midi_velocity), note_dur_(note_dur), render_dur_(render_dur), options_(options),
+          success_(false) { }
+
+protected:
+    void Execute() override {
+        try {
+            success_ = synth_->renderAudioToFile2(output_path_, midi_note_, midi_velocity_, note_dur_, render_dur_,
+                                                  options_);
+        } catch (const std::exception& e) {
+            SetError(e.what());
+        }
+    }
+
+    void OnOK() override {
+        deferred_.Resolve(Napi::Boolean::New(Env(), success_));
+    }
+
+private:
+    std::string output_path_;
+    int midi_note_;
+    double midi_velocity_;
+    double note_dur_;
+    double render_dur_;
+    RenderOptions options_;
+    bool success_;
+};
+
+class RenderSweepWorker : public SynthAsyncWorker {
+public:
+    RenderSweepWorker(Napi::Env env, Napi::Object owner, HeadlessSynth* synth,
+                      const SweepRenderer::Sweep& sweep, int num_threads)
+        : SynthAsyncWorker(env, owner, synth), sweep_(sweep), num_threads_(num_threads), audio_data_() { }
+
+    ~RenderSweepWorker() {
+        delete[] audio_data_.data;
+    }
+
+protected:
+    void Execute() override {
+        try {
+            audio_data_ = SweepRenderer::render(synth_, sweep_, num_threads_);
+        } catch (const std::exception& e) {
+            SetError(e.what());
+        }
+    }
+
+    void OnOK() override {
+        deferred_.Resolve(ExternalAudioBuffer(Env(), audio_data_));
+        audio_data_.data = nullptr;
+    }
+
+private:
+    SweepRenderer::Sweep sweep_;
+    int num_threads_;
+    VitalAudioBuffer audio_data_;
+};
+
+// Native side of synth.renderStream(). Owns a RenderStream and hands its chunks to JS one read() at a time.
+// index.js wraps this in a Readable.
+class RenderStreamWrapper : public Napi::ObjectWrap<RenderStreamWrapper> {
+public:
+    static Napi::Object Init(Napi::Env env, Napi::Object exports) {
+        Napi::Function func = DefineClass(env, "RenderStream", {
+            InstanceMethod("read", &RenderStreamWrapper::Read),
+            InstanceMethod("destroy", &RenderStreamWrapper::Destroy)
+        });
+
+        constructor = Napi::Persistent(func);
+        constructor.SuppressDestruct();
+
+        return exports;
+    }
+
+    RenderStreamWrapper(const Napi::CallbackInfo& info)
+        : Napi::ObjectWrap<RenderStreamWrapper>(info), reading_(false), closed_(true) {
+        // Constructor is called internally, not from JS
+    }
+
+    ~RenderStreamWrapper() {
+        Close();
+    }
+
+    // _open_streams_ counts the streams holding the synth so its blocking methods can refuse to run.
+    void Initialize(Napi::Object owner, HeadlessSynth* synth, const RenderStream::Request& request,
+                    std::shared_ptr<int> open_streams) {
+        owner_ = Napi::Persistent(owner);
+        open_streams_ = std::move(open_streams);
+        ++*open_streams_;
+        closed_ = false;
+        stream_ = std::make_unique<RenderStream>(synth, request);
+    }
+
+    // Called on the JS thread once the last chunk has been read.
+    void FinishRead() {
+        reading_ = false;
+    }
+
+    void Close() {
+        if (stream_)
+            stream_->cancel();
+        if (!closed_) {
+            closed_ = true;
+            --*open_streams_;
+        }
+    }
+
+    RenderStream* GetStream() { return stream_.get(); }
+
+public:
+    static Napi::FunctionReference constructor;
+
+private:
+    Napi::Value Read(const Napi::CallbackInfo& info);
+
+    void Destroy(const Napi::CallbackInfo& info) {
+        Close();
+    }
+
+    Napi::ObjectReference owner_;
+    std::shared_ptr<int> open_streams_;
+    std::unique_ptr<RenderStream> stream_;
+    bool reading_;
+    bool closed_;
+};
+
+Napi::FunctionReference RenderStreamWrapper::constructor;
+
+// Waits on a libuv pool thread for the next chunk of a render stream. Resolves with a Buffer of interleaved
+// stereo floats, or null once the stream is finished or destroyed.
+class StreamReadWorker : public Napi::AsyncWorker {
+public:
+    StreamReadWorker(Napi::Env env, Napi::Object stream_object, RenderStreamWrapper* stream)
+        : Napi::AsyncWorker(env), deferred_(Napi::Promise::Deferred::New(env)), stream_(stream),
+          has_chunk_(false) {
+        stream_object_ = Napi::Persistent(stream_object);
+    }
+
+    Napi::Promise GetPromise() { return deferred_.Promise(); }
+
+protected:
+    void Execute() override {
+        has_chunk_ = stream_->GetStream()->read(chunk_);
+    }
+
+    void OnOK() override {
+        stream_->FinishRead();
+        if (has_chunk_) {
+            std::vector<float>* chunk = new std::vector<float>(std::move(chunk_));
+            deferred_.Resolve(Napi::Buffer<float>::New(Env(), chunk->data(), chunk->size(),
+                                                       [](Napi::Env, float*, std::vector<float>* data) {
+                                                           delete data;
+                                                       }, chunk));
+            return;
+        }
+
+        stream_->Close();
+        std::string error = stream_->GetStream()->getError();
+        if (error.empty())
+            deferred_.Resolve(Env().Null());
+        else
+            deferred_.Reject(Napi::Error::New(Env(), error).Value());
+    }
+
+private:
+    Napi::Promise::Deferred deferred_;
+    Napi::ObjectReference stream_object_;
+    RenderStreamWrapper* stream_;
+    std::vector<float> chunk_;
+    bool has_chunk_;
+};
+
+Napi::Value RenderStreamWrapper::Read(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (reading_) {
+        Napi::Error::New(env, "A read is already pending on this stream").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    reading_ = true;
+    StreamReadWorker* worker = new StreamReadWorker(env, info.This().As<Napi::Object>(), this);
+    Napi::Promise promise = worker->GetPromise();
+    worker->Queue();
+    return promise;
+}
+
 // Main Synth wrapper class
 class SynthWrapper : public Napi::ObjectWrap<SynthWrapper> {
 public:
@@ -266,12 +958,37 @@ public:
             InstanceMethod("setBpm", &SynthWrapper::SetBpm),
             InstanceMethod("render", &SynthWrapper::Render),
             InstanceMethod("renderFile", &SynthWrapper::RenderFile),
+            InstanceMethod("renderInto", &SynthWrapper::RenderInto),
+            InstanceMethod("renderAsync", &SynthWrapper::RenderAsync),
+            InstanceMethod("renderFileAsync", &SynthWrapper::RenderFileAsync),
+            InstanceMethod("renderSequence", &SynthWrapper::RenderSequence),
+            InstanceMethod("renderSequenceFile", &SynthWrapper::RenderSequenceFile),
+            InstanceMethod("renderSweep", &SynthWrapper::RenderSweep),
+            InstanceMethod("_openRenderStream", &SynthWrapper::OpenRenderStream),
             InstanceMethod("loadJson", &SynthWrapper::LoadJson),
             InstanceMethod("toJson", &SynthWrapper::ToJson),
             InstanceMethod("loadPreset", &SynthWrapper::LoadPreset),
+            InstanceMethod("toBinary", &SynthWrapper::ToBinary),
+            InstanceMethod("loadBinary", &SynthWrapper::LoadBinary),
+            InstanceMethod("saveBinaryPreset", &SynthWrapper::SaveBinaryPreset),
             InstanceMethod("loadInitPreset", &SynthWrapper::LoadInitPreset),
+            InstanceMethod("trimVoices", &SynthWrapper::TrimVoices),
+            InstanceMethod("getNumAllocatedVoices", &SynthWrapper::GetNumAllocatedVoices),
+            InstanceMethod("setLeanProcessing", &SynthWrapper::SetLeanProcessing),
+            InstanceMethod("isLeanProcessing", &SynthWrapper::IsLeanProcessing),
+            InstanceMethod("setProfiling", &SynthWrapper::SetProfiling),
+            InstanceMethod("isProfiling", &SynthWrapper::IsProfiling),
+            InstanceMethod("getProfile", &SynthWrapper::GetProfile),
+            InstanceMethod("resetProfile", &SynthWrapper::ResetProfile),
+            InstanceMethod("setWavetableRenderThreads", &SynthWrapper::SetWavetableRenderThreads),
+            InstanceMethod("getWavetableRenderThreads", &SynthWrapper::GetWavetableRenderThreads),
+            InstanceMethod("setWavetableKeyframe", &SynthWrapper::SetWavetableKeyframe),
             InstanceMethod("clearModulations", &SynthWrapper::ClearModulations),
             InstanceMethod("getControls", &SynthWrapper::GetControls),
+            InstanceMethod("setControls", &SynthWrapper::SetControls),
+            InstanceMethod("getControlsNormalized", &SynthWrapper::GetControlsNormalized),
+            InstanceMethod("setControlsNormalized", &SynthWrapper::SetControlsNormalized),
+            InstanceMethod("getControlNames", &SynthWrapper::GetControlNames),
             InstanceMethod("getControlDetails", &SynthWrapper::GetControlDetails),
             InstanceMethod("getControlText", &SynthWrapper::GetControlText),
             // Python compatibility names
@@ -279,12 +996,36 @@ public:
             InstanceMethod("disconnect_modulation", &SynthWrapper::DisconnectModulation),
             InstanceMethod("set_bpm", &SynthWrapper::SetBpm),
             InstanceMethod("render_file", &SynthWrapper::RenderFile),
+            InstanceMethod("render_into", &SynthWrapper::RenderInto),
+            InstanceMethod("render_async", &SynthWrapper::RenderAsync),
+            InstanceMethod("render_file_async", &SynthWrapper::RenderFileAsync),
+            InstanceMethod("render_sequence", &SynthWrapper::RenderSequence),
+            InstanceMethod("render_sequence_file", &SynthWrapper::RenderSequenceFile),
+            InstanceMethod("render_sweep", &SynthWrapper::RenderSweep),
             InstanceMethod("load_json", &SynthWrapper::LoadJson),
+            InstanceMethod("to_binary", &SynthWrapper::ToBinary),
+            InstanceMethod("load_binary", &SynthWrapper::LoadBinary),
+            InstanceMethod("save_binary_preset", &SynthWrapper::SaveBinaryPreset),
             InstanceMethod("to_json", &SynthWrapper::ToJson),
             InstanceMethod("load_preset", &SynthWrapper::LoadPreset),
             InstanceMethod("load_init_preset", &SynthWrapper::LoadInitPreset),
+            InstanceMethod("trim_voices", &SynthWrapper::TrimVoices),
+            InstanceMethod("get_num_allocated_voices", &SynthWrapper::GetNumAllocatedVoices),
+            InstanceMethod("set_lean_processing", &SynthWrapper::SetLeanProcessing),
+            InstanceMethod("is_lean_processing", &SynthWrapper::IsLeanProcessing),
+            InstanceMethod("set_profiling", &SynthWrapper::SetProfiling),
+            InstanceMethod("is_profiling", &SynthWrapper::IsProfiling),
+            InstanceMethod("get_profile", &SynthWrapper::GetProfile),
+            InstanceMethod("reset_profile", &SynthWrapper::ResetProfile),
+            InstanceMethod("set_wavetable_render_threads", &SynthWrapper::SetWavetableRenderThreads),
+            InstanceMethod("get_wavetable_render_threads", &SynthWrapper::GetWavetableRenderThreads),
+            InstanceMethod("set_wavetable_keyframe", &SynthWrapper::SetWavetableKeyframe),
             InstanceMethod("clear_modulations", &SynthWrapper::ClearModulations),
             InstanceMethod("get_controls", &SynthWrapper::GetControls),
+            InstanceMethod("set_controls", &SynthWrapper::SetControls),
+            InstanceMethod("get_controls_normalized", &SynthWrapper::GetControlsNormalized),
+            InstanceMethod("set_controls_normalized", &SynthWrapper::SetControlsNormalized),
+            InstanceMethod("get_control_names", &SynthWrapper::GetControlNames),
             InstanceMethod("get_control_details", &SynthWrapper::GetControlDetails),
             InstanceMethod("get_control_text", &SynthWrapper::GetControlText),
             InstanceAccessor("__state__", &SynthWrapper::GetState, &SynthWrapper::SetState)
@@ -298,6 +1039,12 @@ public:
     }
     
     SynthWrapper(const Napi::CallbackInfo& info) : Napi::ObjectWrap<SynthWrapper>(info) {
+        // createSynths hands over synths it already built and initialized.
+        if (info.Length() > 0 && info[0].IsExternal()) {
+            synth_ = info[0].As<Napi::External<HeadlessSynth>>().Data();
+            return;
+        }
+
         synth_ = new HeadlessSynth();
         synth_->loadInitPreset();
     }
@@ -310,7 +1057,25 @@ public:
     static Napi::FunctionReference constructor;
     
 private:
+    struct IndexedControl {
+        vital::Value* value;
+        const ValueDetails* details;
+    };
+
     HeadlessSynth* synth_;
+    std::shared_ptr<int> open_streams_ = std::make_shared<int>(0);
+    std::vector<IndexedControl> indexed_controls_;
+    Napi::ObjectReference controls_object_;
+
+    // An open render stream holds the engine lock until it's read to the end or destroyed, and it's read
+    // through this thread, so anything that waits for the engine here would never return.
+    bool ThrowIfStreaming(Napi::Env env) {
+        if (*open_streams_ == 0)
+            return false;
+        Napi::Error::New(env, "Synth is busy with a render stream, read it to the end or destroy it first")
+            .ThrowAsJavaScriptException();
+        return true;
+    }
     
     void ConnectModulation(const Napi::CallbackInfo& info) {
         Napi::Env env = info.Env();
@@ -346,6 +1111,8 @@ private:
     
     Napi::Value Render(const Napi::CallbackInfo& info) {
         Napi::Env env = info.Env();
+        if (ThrowIfStreaming(env))
+            return env.Null();
         if (info.Length() < 4 || !info[0].IsNumber() || !info[1].IsNumber() || 
             !info[2].IsNumber() || !info[3].IsNumber()) {
             Napi::TypeError::New(env, "Four numbers expected").ThrowAsJavaScriptException();
@@ -356,43 +1123,311 @@ private:
         double midi_velocity = info[1].As<Napi::Number>().DoubleValue();
         double note_dur = info[2].As<Napi::Number>().DoubleValue();
         double render_dur = info[3].As<Napi::Number>().DoubleValue();
+
+        RenderOptions options;
+        if (!GetRenderOptions(info, 4, options))
+            return env.Null();
         
+        if (options.features.enabled()) {
+            FeatureExtractor features(options.features, options.sample_rate);
+            auto audio_data = synth_->renderAudioToNumpy(midi_note, midi_velocity, note_dur, render_dur, options,
+                                                         &features);
+            return FeatureResult(env, audio_data, features);
+        }
+
         // Get audio data from the synth - this returns a VitalAudioBuffer
-        auto audio_data = synth_->renderAudioToNumpy(midi_note, midi_velocity, note_dur, render_dur);
+        auto audio_data = synth_->renderAudioToNumpy(midi_note, midi_velocity, note_dur, render_dur, options);
         
-        // Extract the raw data from the VitalAudioBuffer
-        float* data_ptr = audio_data.data;
-        size_t total_samples = audio_data.size;
-        
-        // Create a Buffer from the audio data
-        Napi::Buffer<float> buffer = Napi::Buffer<float>::Copy(env, data_ptr, total_samples);
+        // Hand the native allocation straight to JS instead of copying it
+        return ExternalAudioBuffer(env, audio_data);
+    }
+    
+    Napi::Value RenderFile(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        if (ThrowIfStreaming(env))
+            return env.Null();
+        if (info.Length() < 5 || !info[0].IsString() || !info[1].IsNumber() || 
+            !info[2].IsNumber() || !info[3].IsNumber() || !info[4].IsNumber()) {
+            Napi::TypeError::New(env, "String and four numbers expected").ThrowAsJavaScriptException();
+            return env.Null();
+        }
         
-        // Clean up the allocated memory (VitalAudioBuffer doesn't own the data automatically like numpy did)
-        delete[] data_ptr;
+        std::string output_path = info[0].As<Napi::String>().Utf8Value();
+        int midi_note = info[1].As<Napi::Number>().Int32Value();
+        double midi_velocity = info[2].As<Napi::Number>().DoubleValue();
+        double note_dur = info[3].As<Napi::Number>().DoubleValue();
+        double render_dur = info[4].As<Napi::Number>().DoubleValue();
+
+        RenderOptions options;
+        if (!GetRenderOptions(info, 5, options) || !RejectFeatures(env, options))
+            return env.Null();
         
-        return buffer;
+        bool success = synth_->renderAudioToFile2(output_path, midi_note, midi_velocity, note_dur, render_dur, options);
+        return Napi::Boolean::New(env, success);
+    }
+
+    // Renders straight into a caller-owned Float32Array with the same layout as render():
+    // all left channel samples followed by all right channel samples.
+    // Without a render duration the whole array is filled. Returns samples per channel.
+    // Render options go last, after the optional render duration.
+    Napi::Value RenderInto(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        if (ThrowIfStreaming(env))
+            return env.Null();
+        if (info.Length() < 4 || !info[0].IsTypedArray() || !info[1].IsNumber() ||
+            !info[2].IsNumber() || !info[3].IsNumber()) {
+            Napi::TypeError::New(env, "Float32Array and three numbers expected").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+
+        Napi::TypedArray typed_array = info[0].As<Napi::TypedArray>();
+        if (typed_array.TypedArrayType() != napi_float32_array) {
+            Napi::TypeError::New(env, "Float32Array expected").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        Napi::Float32Array output = info[0].As<Napi::Float32Array>();
+
+        int midi_note = info[1].As<Napi::Number>().Int32Value();
+        double midi_velocity = info[2].As<Napi::Number>().DoubleValue();
+        double note_dur = info[3].As<Napi::Number>().DoubleValue();
+
+        bool has_render_dur = info.Length() > 4 && info[4].IsNumber();
+        RenderOptions options;
+        if (!GetRenderOptions(info, has_render_dur ? 5 : 4, options) || !RejectFeatures(env, options))
+            return env.Null();
+
+        size_t max_samples = output.ElementLength() / 2;
+        size_t total_samples = max_samples;
+        if (has_render_dur) {
+            double render_dur = info[4].As<Napi::Number>().DoubleValue();
+            total_samples = static_cast<size_t>(std::max(0, options.numSamples(render_dur)));
+            if (total_samples > max_samples) {
+                Napi::RangeError::New(env, "Float32Array too small for render duration").ThrowAsJavaScriptException();
+                return env.Null();
+            }
+        }
+
+        int num_samples = synth_->renderAudioToBuffer(output.Data(), static_cast<int>(total_samples), midi_note,
+                                                      midi_velocity, note_dur, options);
+        return Napi::Number::New(env, num_samples);
+    }
+
+    Napi::Value RenderAsync(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        if (ThrowIfStreaming(env))
+            return env.Null();
+        if (info.Length() < 4 || !info[0].IsNumber() || !info[1].IsNumber() ||
+            !info[2].IsNumber() || !info[3].IsNumber()) {
+            Napi::TypeError::New(env, "Four numbers expected").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+
+        int midi_note = info[0].As<Napi::Number>().Int32Value();
+        double midi_velocity = info[1].As<Napi::Number>().DoubleValue();
+        double note_dur = info[2].As<Napi::Number>().DoubleValue();
+        double render_dur = info[3].As<Napi::Number>().DoubleValue();
+
+        RenderOptions options;
+        if (!GetRenderOptions(info, 4, options))
+            return env.Null();
+
+        RenderWorker* worker = new RenderWorker(env, info.This().As<Napi::Object>(), synth_,
+                                                midi_note, midi_velocity, note_dur, render_dur, options);
+        Napi::Promise promise = worker->GetPromise();
+        worker->Queue();
+        return promise;
+    }
+
+    Napi::Value RenderFileAsync(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        if (ThrowIfStreaming(env))
+            return env.Null();
+        if (info.Length() < 5 || !info[0].IsString() || !info[1].IsNumber() ||
+            !info[2].IsNumber() || !info[3].IsNumber() || !info[4].IsNumber()) {
+            Napi::TypeError::New(env, "String and four numbers expected").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+
+        std::string output_path = info[0].As<Napi::String>().Utf8Value();
+        int midi_note = info[1].As<Napi::Number>().Int32Value();
+        double midi_velocity = info[2].As<Napi::Number>().DoubleValue();
+        double note_dur = info[3].As<Napi::Number>().DoubleValue();
+        double render_dur = info[4].As<Napi::Number>().DoubleValue();
+
+        RenderOptions options;
+        if (!GetRenderOptions(info, 5, options) || !RejectFeatures(env, options))
+            return env.Null();
+
+        RenderFileWorker* worker = new RenderFileWorker(env, info.This().As<Napi::Object>(), synth_, output_path,
+                                                        midi_note, midi_velocity, note_dur, render_dur, options);
+        Napi::Promise promise = worker->GetPromise();
+        worker->Queue();
+        return promise;
+    }
+
+    // renderSequence(events | midiFilePath, renderDuration[, options])
+    // Plays the whole sequence in one pass and returns audio laid out like render().
+    Napi::Value RenderSequence(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        if (ThrowIfStreaming(env))
+            return env.Null();
+        if (info.Length() < 2 || !info[1].IsNumber()) {
+            Napi::TypeError::New(env, "Events and render duration expected").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+
+        RenderOptions options;
+        if (!GetRenderOptions(info, 2, options))
+            return env.Null();
+
+        ::RenderSequence sequence;
+        if (!ReadRenderSequence(env, info[0], options, sequence))
+            return env.Null();
+
+        double render_dur = info[1].As<Napi::Number>().DoubleValue();
+        if (options.features.enabled()) {
+            FeatureExtractor features(options.features, options.sample_rate);
+            VitalAudioBuffer audio_data = synth_->renderSequence(sequence, render_dur, options, &features);
+            return FeatureResult(env, audio_data, features);
+        }
+        return ExternalAudioBuffer(env, synth_->renderSequence(sequence, render_dur, options));
+    }
+
+    // renderSequenceFile(outputPath, events | midiFilePath, renderDuration[, options])
+    Napi::Value RenderSequenceFile(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        if (ThrowIfStreaming(env))
+            return env.Null();
+        if (info.Length() < 3 || !info[0].IsString() || !info[2].IsNumber()) {
+            Napi::TypeError::New(env, "Output path, events and render duration expected").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+
+        RenderOptions options;
+        if (!GetRenderOptions(info, 3, options) || !RejectFeatures(env, options))
+            return env.Null();
+
+        ::RenderSequence sequence;
+        if (!ReadRenderSequence(env, info[1], options, sequence))
+            return env.Null();
+
+        std::string output_path = info[0].As<Napi::String>().Utf8Value();
+        double render_dur = info[2].As<Napi::Number>().DoubleValue();
+        bool success = synth_->renderSequenceToFile(output_path, sequence, render_dur, options);
+        return Napi::Boolean::New(env, success);
+    }
+
+    // renderSweep(control, values, note, velocity, noteDuration, renderDuration[, options])
+    // Renders the note once per value of _control_ and resolves with every render back to back, each laid
+    // out like render(). On top of the render options, normalized treats the values as 0-1 positions and
+    // threads caps how many threads share the work.
+    Napi::Value RenderSweep(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        if (info.Length() < 6 || !info[0].IsString() || !info[2].IsNumber() || !info[3].IsNumber() ||
+            !info[4].IsNumber() || !info[5].IsNumber()) {
+            Napi::TypeError::New(env, "Control name, values and four numbers expected").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        if (ThrowIfStreaming(env))
+            return env.Null();
+
+        SweepRenderer::Sweep sweep;
+        sweep.control = info[0].As<Napi::String>().Utf8Value();
+        if (!ReadNumberList(info[1], sweep.values)) {
+            Napi::TypeError::New(env, "Sweep values must be an array or typed array of numbers")
+                .ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        if (synth_->getControls().count(sweep.control) == 0) {
+            Napi::Error::New(env, "No control: " + sweep.control).ThrowAsJavaScriptException();
+            return env.Null();
+        }
+
+        sweep.note = info[2].As<Napi::Number>().Int32Value();
+        sweep.velocity = info[3].As<Napi::Number>().FloatValue();
+        sweep.note_duration = info[4].As<Napi::Number>().FloatValue();
+        sweep.render_duration = info[5].As<Napi::Number>().FloatValue();
+        if (!GetRenderOptions(info, 6, sweep.options) || !RejectFeatures(env, sweep.options))
+            return env.Null();
+
+        int num_threads = std::max(1u, std::thread::hardware_concurrency());
+        if (info.Length() > 6 && info[6].IsObject()) {
+            Napi::Object object = info[6].As<Napi::Object>();
+            Napi::Value normalized = object.Get("normalized");
+            Napi::Value threads = object.Get("threads");
+            if ((!normalized.IsUndefined() && !normalized.IsBoolean()) ||
+                (!threads.IsUndefined() && !threads.IsNumber())) {
+                Napi::TypeError::New(env, "normalized must be a boolean and threads a number")
+                    .ThrowAsJavaScriptException();
+                return env.Null();
+            }
+            if (threads.IsNumber())
+                num_threads = std::max(1, threads.As<Napi::Number>().Int32Value());
+            if (normalized.IsBoolean() && normalized.As<Napi::Boolean>().Value()) {
+                const ValueDetails& details = Parameters::getDetails(sweep.control);
+                for (float& value : sweep.values)
+                    value = NormalizedToValue(details, value);
+            }
+        }
+
+        RenderSweepWorker* worker = new RenderSweepWorker(env, info.This().As<Napi::Object>(), synth_,
+                                                          sweep, num_threads);
+        Napi::Promise promise = worker->GetPromise();
+        worker->Queue();
+        return promise;
     }
-    
-    Napi::Value RenderFile(const Napi::CallbackInfo& info) {
+
+    // _openRenderStream(note, velocity, noteDuration, renderDuration[, options]), wrapped by renderStream()
+    // in index.js. On top of the render options, chunkSize sets the frames per chunk and bufferedChunks how
+    // many chunks can wait to be read before the render pauses.
+    Napi::Value OpenRenderStream(const Napi::CallbackInfo& info) {
         Napi::Env env = info.Env();
-        if (info.Length() < 5 || !info[0].IsString() || !info[1].IsNumber() || 
-            !info[2].IsNumber() || !info[3].IsNumber() || !info[4].IsNumber()) {
-            Napi::TypeError::New(env, "String and four numbers expected").ThrowAsJavaScriptException();
+        if (info.Length() < 4 || !info[0].IsNumber() || !info[1].IsNumber() ||
+            !info[2].IsNumber() || !info[3].IsNumber()) {
+            Napi::TypeError::New(env, "Four numbers expected").ThrowAsJavaScriptException();
             return env.Null();
         }
-        
-        std::string output_path = info[0].As<Napi::String>().Utf8Value();
-        int midi_note = info[1].As<Napi::Number>().Int32Value();
-        double midi_velocity = info[2].As<Napi::Number>().DoubleValue();
-        double note_dur = info[3].As<Napi::Number>().DoubleValue();
-        double render_dur = info[4].As<Napi::Number>().DoubleValue();
-        
-        bool success = synth_->renderAudioToFile2(output_path, midi_note, midi_velocity, note_dur, render_dur);
-        return Napi::Boolean::New(env, success);
+        if (ThrowIfStreaming(env))
+            return env.Null();
+
+        RenderStream::Request request;
+        request.note = info[0].As<Napi::Number>().Int32Value();
+        request.velocity = info[1].As<Napi::Number>().FloatValue();
+        request.note_duration = info[2].As<Napi::Number>().FloatValue();
+        request.render_duration = info[3].As<Napi::Number>().FloatValue();
+        if (!GetRenderOptions(info, 4, request.options) || !RejectFeatures(env, request.options))
+            return env.Null();
+
+        if (info.Length() > 4 && info[4].IsObject()) {
+            Napi::Object object = info[4].As<Napi::Object>();
+            Napi::Value chunk_size = object.Get("chunkSize");
+            Napi::Value buffered_chunks = object.Get("bufferedChunks");
+            if ((!chunk_size.IsUndefined() && !chunk_size.IsNumber()) ||
+                (!buffered_chunks.IsUndefined() && !buffered_chunks.IsNumber())) {
+                Napi::TypeError::New(env, "Render options must be numbers").ThrowAsJavaScriptException();
+                return env.Null();
+            }
+            if (chunk_size.IsNumber())
+                request.chunk_samples = chunk_size.As<Napi::Number>().Int32Value();
+            if (buffered_chunks.IsNumber())
+                request.max_chunks = buffered_chunks.As<Napi::Number>().Int32Value();
+            if (request.chunk_samples < 1 || request.max_chunks < 1) {
+                Napi::RangeError::New(env, "chunkSize and bufferedChunks must be at least 1")
+                    .ThrowAsJavaScriptException();
+                return env.Null();
+            }
+        }
+
+        Napi::Object stream = RenderStreamWrapper::constructor.New({});
+        RenderStreamWrapper* unwrapped = Napi::ObjectWrap<RenderStreamWrapper>::Unwrap(stream);
+        unwrapped->Initialize(info.This().As<Napi::Object>(), synth_, request, open_streams_);
+        return stream;
     }
-    
+
     void LoadJson(const Napi::CallbackInfo& info) {
         Napi::Env env = info.Env();
+        if (ThrowIfStreaming(env))
+            return;
         if (info.Length() < 1 || !info[0].IsString()) {
             Napi::TypeError::New(env, "String expected").ThrowAsJavaScriptException();
             return;
@@ -402,11 +1437,15 @@ private:
     }
     
     Napi::Value ToJson(const Napi::CallbackInfo& info) {
+        if (ThrowIfStreaming(info.Env()))
+            return info.Env().Null();
         return Napi::String::New(info.Env(), synth_->pyToJson());
     }
     
     Napi::Value LoadPreset(const Napi::CallbackInfo& info) {
         Napi::Env env = info.Env();
+        if (ThrowIfStreaming(env))
+            return env.Null();
         if (info.Length() < 1 || !info[0].IsString()) {
             Napi::TypeError::New(env, "String expected").ThrowAsJavaScriptException();
             return env.Null();
@@ -416,7 +1455,186 @@ private:
         return Napi::Boolean::New(env, success);
     }
     
+    Napi::Value ToBinary(const Napi::CallbackInfo& info) {
+        if (ThrowIfStreaming(info.Env()))
+            return info.Env().Null();
+        MemoryBlock data;
+        synth_->saveToBinary(data);
+        return Napi::Buffer<uint8_t>::Copy(info.Env(), static_cast<const uint8_t*>(data.getData()), data.getSize());
+    }
+
+    Napi::Value LoadBinary(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        if (ThrowIfStreaming(env))
+            return env.Null();
+        if (info.Length() < 1 || !info[0].IsBuffer()) {
+            Napi::TypeError::New(env, "Buffer expected").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        Napi::Buffer<uint8_t> buffer = info[0].As<Napi::Buffer<uint8_t>>();
+        std::string error;
+        bool success = synth_->loadFromBinary(buffer.Data(), buffer.Length(), error);
+        if (!success)
+            std::cerr << "Error: " << error << std::endl;
+        return Napi::Boolean::New(env, success);
+    }
+
+    Napi::Value SaveBinaryPreset(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        if (ThrowIfStreaming(env))
+            return env.Null();
+        if (info.Length() < 1 || !info[0].IsString()) {
+            Napi::TypeError::New(env, "String expected").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        std::string filepath = info[0].As<Napi::String>().Utf8Value();
+        return Napi::Boolean::New(env, synth_->saveToBinaryFile(File(filepath)));
+    }
+
+    Napi::Value TrimVoices(const Napi::CallbackInfo& info) {
+        if (ThrowIfStreaming(info.Env()))
+            return info.Env().Null();
+        return Napi::Number::New(info.Env(), synth_->trimVoices());
+    }
+
+    Napi::Value GetNumAllocatedVoices(const Napi::CallbackInfo& info) {
+        return Napi::Number::New(info.Env(), synth_->getNumAllocatedVoices());
+    }
+
+    void SetLeanProcessing(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        if (info.Length() < 1 || !info[0].IsBoolean()) {
+            Napi::TypeError::New(env, "Boolean expected").ThrowAsJavaScriptException();
+            return;
+        }
+        if (ThrowIfStreaming(env))
+            return;
+        synth_->setLeanProcessing(info[0].As<Napi::Boolean>().Value());
+    }
+
+    Napi::Value IsLeanProcessing(const Napi::CallbackInfo& info) {
+        return Napi::Boolean::New(info.Env(), synth_->isLeanProcessing());
+    }
+
+    void SetProfiling(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        if (info.Length() < 1 || !info[0].IsBoolean()) {
+            Napi::TypeError::New(env, "Boolean expected").ThrowAsJavaScriptException();
+            return;
+        }
+        if (ThrowIfStreaming(env))
+            return;
+        synth_->setProfiling(info[0].As<Napi::Boolean>().Value());
+    }
+
+    Napi::Value IsProfiling(const Napi::CallbackInfo& info) {
+        return Napi::Boolean::New(info.Env(), synth_->isProfiling());
+    }
+
+    // Returns { group: { cycles, calls, seconds } } with the busiest module groups first.
+    Napi::Value GetProfile(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        if (ThrowIfStreaming(env))
+            return env.Null();
+
+        Napi::Object profile = Napi::Object::New(env);
+        for (const vital::ProcessorProfiler::Report& report : synth_->getProfile()) {
+            Napi::Object group = Napi::Object::New(env);
+            group.Set("cycles", static_cast<double>(report.cycles));
+            group.Set("calls", static_cast<double>(report.calls));
+            group.Set("seconds", report.seconds);
+            profile.Set(report.name, group);
+        }
+        return profile;
+    }
+
+    void ResetProfile(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        if (ThrowIfStreaming(env))
+            return;
+        synth_->resetProfile();
+    }
+
+    void SetWavetableRenderThreads(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        if (info.Length() < 1 || !info[0].IsNumber()) {
+            Napi::TypeError::New(env, "Number expected").ThrowAsJavaScriptException();
+            return;
+        }
+        int num_threads = info[0].As<Napi::Number>().Int32Value();
+        if (num_threads < 1) {
+            Napi::RangeError::New(env, "Thread count must be at least 1").ThrowAsJavaScriptException();
+            return;
+        }
+        if (ThrowIfStreaming(env))
+            return;
+        synth_->setWavetableRenderThreads(num_threads);
+    }
+
+    Napi::Value GetWavetableRenderThreads(const Napi::CallbackInfo& info) {
+        return Napi::Number::New(info.Env(), synth_->getWavetableRenderThreads());
+    }
+
+    Napi::Value SetWavetableKeyframe(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        if (info.Length() < 5 || !info[0].IsNumber() || !info[1].IsNumber() || !info[2].IsNumber() ||
+            !info[3].IsNumber() || !info[4].IsString()) {
+            Napi::TypeError::New(env, "Expected (oscillator, group, component, keyframe, json)")
+                .ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        if (ThrowIfStreaming(env))
+            return env.Null();
+
+        int oscillator = info[0].As<Napi::Number>().Int32Value();
+        int group = info[1].As<Napi::Number>().Int32Value();
+        int component = info[2].As<Napi::Number>().Int32Value();
+        int keyframe = info[3].As<Napi::Number>().Int32Value();
+        WavetableCreator* creator = nullptr;
+        if (oscillator >= 0 && oscillator < vital::kNumOscillators)
+            creator = synth_->getWavetableCreator(oscillator);
+        if (creator == nullptr || group < 0 || group >= creator->numGroups() ||
+            component < 0 || component >= creator->getGroup(group)->numComponents() ||
+            keyframe < 0 || keyframe >= creator->getGroup(group)->getComponent(component)->numFrames()) {
+            Napi::RangeError::New(env, "No wavetable keyframe at that index").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+
+        json data;
+        try {
+            data = json::parse(info[4].As<Napi::String>().Utf8Value());
+        }
+        catch (const json::exception& e) {
+            Napi::Error::New(env, "Keyframe json is corrupted.").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        if (!data.is_object()) {
+            Napi::TypeError::New(env, "Keyframe json must be an object").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        if (data.count("position")) {
+            if (!data["position"].is_number_integer() || data["position"] < 0 ||
+                data["position"] >= vital::kNumOscillatorWaveFrames) {
+                Napi::RangeError::New(env, "Keyframe position must be between 0 and " +
+                                      std::to_string(vital::kNumOscillatorWaveFrames - 1))
+                    .ThrowAsJavaScriptException();
+                return env.Null();
+            }
+        }
+
+        try {
+            int rendered = synth_->setWavetableKeyframe(oscillator, group, component, keyframe, data);
+            return Napi::Number::New(env, rendered);
+        }
+        catch (const json::exception& e) {
+            Napi::Error::New(env, std::string("Invalid keyframe json: ") + e.what()).ThrowAsJavaScriptException();
+            return env.Null();
+        }
+    }
+
     void LoadInitPreset(const Napi::CallbackInfo& info) {
+        if (ThrowIfStreaming(info.Env()))
+            return;
         synth_->loadInitPreset();
     }
     
@@ -424,8 +1642,17 @@ private:
         synth_->clearModulations();
     }
     
+    // getControls() returns the ControlValue wrappers by name. getControls(float32Array) fills the array
+    // with every control's raw value instead, in getControlNames() order.
     Napi::Value GetControls(const Napi::CallbackInfo& info) {
         Napi::Env env = info.Env();
+        if (info.Length() > 0)
+            return ReadControls(info, false);
+
+        // The wrappers read and write the engine directly, so one set serves every call.
+        if (!controls_object_.IsEmpty())
+            return controls_object_.Value();
+
         Napi::Object result = Napi::Object::New(env);
         
         auto &controls = synth_->getControls();
@@ -437,8 +1664,88 @@ private:
             result.Set(name, wrapper);
         }
         
+        controls_object_ = Napi::Persistent(result);
         return result;
     }
+
+    Napi::Value GetControlsNormalized(const Napi::CallbackInfo& info) {
+        return ReadControls(info, true);
+    }
+
+    void SetControls(const Napi::CallbackInfo& info) {
+        WriteControls(info, false);
+    }
+
+    void SetControlsNormalized(const Napi::CallbackInfo& info) {
+        WriteControls(info, true);
+    }
+
+    // Control names in the order the bulk control methods use. The order is the same for every synth.
+    Napi::Value GetControlNames(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        auto &controls = synth_->getControls();
+        Napi::Array names = Napi::Array::New(env, controls.size());
+        uint32_t index = 0;
+        for (const auto &[name, value] : controls)
+            names.Set(index++, name);
+        return names;
+    }
+
+    const std::vector<IndexedControl>& GetIndexedControls() {
+        if (indexed_controls_.empty()) {
+            auto &controls = synth_->getControls();
+            indexed_controls_.reserve(controls.size());
+            for (const auto &[name, value] : controls)
+                indexed_controls_.push_back({ value, &Parameters::getDetails(name) });
+        }
+        return indexed_controls_;
+    }
+
+    // Checks that _info[0]_ is a Float32Array with exactly one value per control.
+    bool GetControlArray(const Napi::CallbackInfo& info, Napi::Float32Array& array) {
+        Napi::Env env = info.Env();
+        if (info.Length() < 1 || !info[0].IsTypedArray() ||
+            info[0].As<Napi::TypedArray>().TypedArrayType() != napi_float32_array) {
+            Napi::TypeError::New(env, "Float32Array expected").ThrowAsJavaScriptException();
+            return false;
+        }
+
+        array = info[0].As<Napi::Float32Array>();
+        size_t num_controls = GetIndexedControls().size();
+        if (array.ElementLength() != num_controls) {
+            Napi::RangeError::New(env, "Float32Array must hold one value per control (" +
+                                  std::to_string(num_controls) + ")").ThrowAsJavaScriptException();
+            return false;
+        }
+        return true;
+    }
+
+    Napi::Value ReadControls(const Napi::CallbackInfo& info, bool normalized) {
+        Napi::Float32Array array;
+        if (!GetControlArray(info, array))
+            return info.Env().Null();
+
+        const std::vector<IndexedControl>& controls = GetIndexedControls();
+        float* data = array.Data();
+        for (size_t i = 0; i < controls.size(); ++i) {
+            float value = controls[i].value->value();
+            data[i] = normalized ? ValueToNormalized(*controls[i].details, value) : value;
+        }
+        return array;
+    }
+
+    void WriteControls(const Napi::CallbackInfo& info, bool normalized) {
+        Napi::Float32Array array;
+        if (!GetControlArray(info, array))
+            return;
+
+        const std::vector<IndexedControl>& controls = GetIndexedControls();
+        const float* data = array.Data();
+        for (size_t i = 0; i < controls.size(); ++i) {
+            float value = normalized ? NormalizedToValue(*controls[i].details, data[i]) : data[i];
+            controls[i].value->set(poly_float(value));
+        }
+    }
     
     Napi::Value GetControlDetails(const Napi::CallbackInfo& info) {
         Napi::Env env = info.Env();
@@ -493,6 +1800,8 @@ private:
     
     // Serialization support (equivalent to Python's __getstate__ and __setstate__)
     Napi::Value GetState(const Napi::CallbackInfo& info) {
+        if (ThrowIfStreaming(info.Env()))
+            return info.Env().Null();
         return Napi::String::New(info.Env(), synth_->pyToJson());
     }
     
@@ -501,6 +1810,8 @@ private:
             Napi::TypeError::New(info.Env(), "String expected").ThrowAsJavaScriptException();
             return;
         }
+        if (ThrowIfStreaming(info.Env()))
+            return;
         std::string json = value.As<Napi::String>().Utf8Value();
         synth_->loadFromString(json);
     }
@@ -508,6 +1819,269 @@ private:
 
 Napi::FunctionReference SynthWrapper::constructor;
 
+// Builds a pool of synths on several threads at once. Building the engine graph is most of
+// the cost of a new Synth, so this is much faster than constructing them one by one.
+class CreateSynthsWorker : public Napi::AsyncWorker {
+public:
+    static constexpr int kMaxSynths = 1024;
+
+    CreateSynthsWorker(Napi::Env env, int count)
+        : Napi::AsyncWorker(env), deferred_(Napi::Promise::Deferred::New(env)), synths_(count, nullptr) { }
+
+    ~CreateSynthsWorker() {
+        for (HeadlessSynth* synth : synths_)
+            delete synth;
+    }
+
+    Napi::Promise GetPromise() { return deferred_.Promise(); }
+
+protected:
+    void Execute() override {
+        int num_synths = static_cast<int>(synths_.size());
+        int num_threads = std::min<int>(num_synths, std::max(1u, std::thread::hardware_concurrency()));
+        std::atomic<int> next_synth(0);
+        std::mutex error_mutex;
+        std::string error;
+
+        // An exception escaping a std::thread terminates the process, so each thread stops the
+        // others at its first failure and the error is reported once they've all joined.
+        auto create = [this, num_synths, &next_synth, &error_mutex, &error]() {
+            for (int index = next_synth++; index < num_synths; index = next_synth++) {
+                try {
+                    synths_[index] = new HeadlessSynth();
+                    synths_[index]->loadInitPreset();
+                } catch (const std::exception& e) {
+                    next_synth = num_synths;
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (error.empty())
+                        error = e.what();
+                }
+            }
+        };
+
+        // Whatever threads start share the remaining synths, and this one works too if none can.
+        std::vector<std::thread> threads;
+        try {
+            for (int i = 1; i < num_threads; ++i)
+                threads.emplace_back(create);
+        } catch (const std::system_error&) { }
+        create();
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        if (!error.empty())
+            SetError("Couldn't create synths: " + error);
+    }
+
+    void OnOK() override {
+        Napi::Env env = Env();
+        Napi::Array result = Napi::Array::New(env, synths_.size());
+        for (size_t i = 0; i < synths_.size(); ++i) {
+            result.Set(i, SynthWrapper::constructor.New({ Napi::External<HeadlessSynth>::New(env, synths_[i]) }));
+            synths_[i] = nullptr;
+        }
+        deferred_.Resolve(result);
+    }
+
+    void OnError(const Napi::Error& error) override {
+        deferred_.Reject(error.Value());
+    }
+
+private:
+    Napi::Promise::Deferred deferred_;
+    std::vector<HeadlessSynth*> synths_;
+};
+
+static Napi::Object BatchResultToObject(Napi::Env env, BatchRenderer::Result& result) {
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("id", result.id);
+    obj.Set("success", result.success);
+    obj.Set("duration", result.duration_ms);
+
+    if (!result.success)
+        obj.Set("error", result.error);
+    else if (result.audio.data) {
+        obj.Set("audio", ExternalAudioBuffer(env, result.audio));
+        result.audio.data = nullptr;
+    }
+    else
+        obj.Set("fileSize", static_cast<double>(result.file_size));
+
+    return obj;
+}
+
+// Runs a batch on the native render pool. Each finished job is streamed to JS through a
+// ThreadSafeFunction and the Promise resolves once the last result has been delivered.
+class BatchRenderWorker : public Napi::AsyncWorker {
+public:
+    BatchRenderWorker(Napi::Env env, Napi::Object owner, BatchRenderer* renderer,
+                      std::vector<BatchRenderer::Job> jobs, Napi::Function on_result)
+        : Napi::AsyncWorker(env), deferred_(Napi::Promise::Deferred::New(env)),
+          renderer_(renderer), jobs_(std::move(jobs)), outcome_(std::make_shared<Outcome>()) {
+        owner_ = Napi::Persistent(owner);
+        Napi::Promise::Deferred deferred = deferred_;
+        std::shared_ptr<Outcome> outcome = outcome_;
+        on_result_ = Napi::ThreadSafeFunction::New(env, on_result, "BatchRenderer", 0, 1,
+                                                   [deferred, outcome](Napi::Env env) {
+            if (outcome->settled)
+                return;
+            if (outcome->callback_error.IsEmpty())
+                deferred.Resolve(env.Undefined());
+            else
+                deferred.Reject(outcome->callback_error.Value());
+        });
+    }
+
+    Napi::Promise GetPromise() { return deferred_.Promise(); }
+
+protected:
+    void Execute() override {
+        std::shared_ptr<Outcome> outcome = outcome_;
+        try {
+            renderer_->renderJobs(jobs_, [this, outcome](BatchRenderer::Result& result) {
+                BatchRenderer::Result* delivered = new BatchRenderer::Result(result);
+                result.audio.data = nullptr;
+
+                // Once onResult throws, later results are dropped and the batch rejects with that error
+                // after the last job.
+                auto callback = [outcome](Napi::Env env, Napi::Function on_result, BatchRenderer::Result* result) {
+                    if (outcome->callback_error.IsEmpty()) {
+                        try {
+                            on_result.Call({ BatchResultToObject(env, *result) });
+                        } catch (const Napi::Error& e) {
+                            outcome->callback_error = Napi::Persistent(e.Value());
+                        }
+                    }
+                    delete[] result->audio.data;
+                    delete result;
+                };
+                if (on_result_.BlockingCall(delivered, callback) != napi_ok) {
+                    delete[] delivered->audio.data;
+                    delete delivered;
+                }
+            });
+        } catch (const std::exception& e) {
+            SetError(e.what());
+        }
+    }
+
+    void OnOK() override {
+        on_result_.Release();
+    }
+
+    void OnError(const Napi::Error& error) override {
+        outcome_->settled = true;
+        deferred_.Reject(error.Value());
+        on_result_.Release();
+    }
+
+private:
+    // Shared with the thread safe function, which can outlive the worker. Only touched on the JS thread.
+    struct Outcome {
+        Napi::ObjectReference callback_error;
+        bool settled = false;
+    };
+
+    Napi::Promise::Deferred deferred_;
+    Napi::ObjectReference owner_;
+    Napi::ThreadSafeFunction on_result_;
+    BatchRenderer* renderer_;
+    std::vector<BatchRenderer::Job> jobs_;
+    std::shared_ptr<Outcome> outcome_;
+};
+
+// Pool of native render threads, each with its own HeadlessSynth.
+class BatchRendererWrapper : public Napi::ObjectWrap<BatchRendererWrapper> {
+public:
+    static Napi::Object Init(Napi::Env env, Napi::Object exports) {
+        Napi::Function func = DefineClass(env, "NativeBatchRenderer", {
+            InstanceMethod("render", &BatchRendererWrapper::Render),
+            InstanceMethod("getNumThreads", &BatchRendererWrapper::GetNumThreads)
+        });
+
+        constructor = Napi::Persistent(func);
+        constructor.SuppressDestruct();
+
+        exports.Set("NativeBatchRenderer", func);
+        return exports;
+    }
+
+    BatchRendererWrapper(const Napi::CallbackInfo& info) : Napi::ObjectWrap<BatchRendererWrapper>(info) {
+        int num_threads = std::thread::hardware_concurrency();
+        if (info.Length() > 0 && info[0].IsNumber())
+            num_threads = info[0].As<Napi::Number>().Int32Value();
+        renderer_ = new BatchRenderer(num_threads);
+    }
+
+    ~BatchRendererWrapper() {
+        delete renderer_;
+    }
+
+public:
+    static Napi::FunctionReference constructor;
+
+private:
+    BatchRenderer* renderer_;
+
+    static float GetJobNumber(const Napi::Object& job, const char* key, float default_value) {
+        Napi::Value value = job.Get(key);
+        return value.IsNumber() ? value.As<Napi::Number>().FloatValue() : default_value;
+    }
+
+    static std::string GetJobString(const Napi::Object& job, const char* key) {
+        Napi::Value value = job.Get(key);
+        return value.IsString() ? value.As<Napi::String>().Utf8Value() : std::string();
+    }
+
+    // render(jobs, onResult) where each job is
+    // { id, presetPath, outputPath, note, velocity, noteDuration, renderDuration, sampleRate, blockSize, bitDepth }.
+    // Jobs without an outputPath deliver their audio as a Buffer on the result.
+    Napi::Value Render(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        if (info.Length() < 2 || !info[0].IsArray() || !info[1].IsFunction()) {
+            Napi::TypeError::New(env, "Array of jobs and callback expected").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+
+        Napi::Array js_jobs = info[0].As<Napi::Array>();
+        std::vector<BatchRenderer::Job> jobs;
+        jobs.reserve(js_jobs.Length());
+        for (uint32_t i = 0; i < js_jobs.Length(); ++i) {
+            Napi::Value value = js_jobs.Get(i);
+            if (!value.IsObject()) {
+                Napi::TypeError::New(env, "Job objects expected").ThrowAsJavaScriptException();
+                return env.Null();
+            }
+
+            Napi::Object js_job = value.As<Napi::Object>();
+            BatchRenderer::Job job;
+            job.id = static_cast<int>(GetJobNumber(js_job, "id", i));
+            job.preset_path = GetJobString(js_job, "presetPath");
+            job.output_path = GetJobString(js_job, "outputPath");
+            job.note = static_cast<int>(GetJobNumber(js_job, "note", job.note));
+            job.velocity = GetJobNumber(js_job, "velocity", job.velocity);
+            job.note_duration = GetJobNumber(js_job, "noteDuration", job.note_duration);
+            job.render_duration = GetJobNumber(js_job, "renderDuration", job.render_duration);
+            if (!ReadRenderOptions(env, js_job, job.options) || !RejectFeatures(env, job.options))
+                return env.Null();
+            jobs.push_back(job);
+        }
+
+        BatchRenderWorker* worker = new BatchRenderWorker(env, info.This().As<Napi::Object>(), renderer_,
+                                                          std::move(jobs), info[1].As<Napi::Function>());
+        Napi::Promise promise = worker->GetPromise();
+        worker->Queue();
+        return promise;
+    }
+
+    Napi::Value GetNumThreads(const Napi::CallbackInfo& info) {
+        return Napi::Number::New(info.Env(), renderer_->getNumThreads());
+    }
+};
+
+Napi::FunctionReference BatchRendererWrapper::constructor;
+
 // Create constants object with all enums
 Napi::Object CreateConstantsObject(Napi::Env env) {
     Napi::Object constants = Napi::Object::New(env);
@@ -724,17 +2298,119 @@ Napi::Value GetModulationDestinations(const Napi::CallbackInfo& info) {
     return result;
 }
 
+Napi::Value GetWavetableCacheStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    WavetableCache::Stats stats = WavetableCache::getInstance()->getStats();
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("size", stats.size);
+    result.Set("capacity", stats.capacity);
+    result.Set("hits", static_cast<double>(stats.hits));
+    result.Set("misses", static_cast<double>(stats.misses));
+    return result;
+}
+
+void SetWavetableCacheSize(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1 || !info[0].IsNumber()) {
+        Napi::TypeError::New(env, "Number expected").ThrowAsJavaScriptException();
+        return;
+    }
+    int capacity = info[0].As<Napi::Number>().Int32Value();
+    if (capacity < 0) {
+        Napi::RangeError::New(env, "Cache size can't be negative").ThrowAsJavaScriptException();
+        return;
+    }
+    WavetableCache::getInstance()->setCapacity(capacity);
+}
+
+void ClearWavetableCache(const Napi::CallbackInfo& info) {
+    WavetableCache::getInstance()->clear();
+}
+
+Napi::Value CreateSynths(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1 || !info[0].IsNumber()) {
+        Napi::TypeError::New(env, "Number expected").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    int count = info[0].As<Napi::Number>().Int32Value();
+    if (count < 0 || count > CreateSynthsWorker::kMaxSynths) {
+        Napi::RangeError::New(env, "Synth count must be between 0 and " +
+                              std::to_string(CreateSynthsWorker::kMaxSynths)).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    CreateSynthsWorker* worker = new CreateSynthsWorker(env, count);
+    Napi::Promise promise = worker->GetPromise();
+    worker->Queue();
+    return promise;
+}
+
+Napi::Value PresetJsonToBinary(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "String expected").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    json state;
+    try {
+        state = json::parse(info[0].As<Napi::String>().Utf8Value());
+    }
+    catch (const json::exception& e) {
+        Napi::Error::New(env, "Preset json is corrupted.").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    MemoryBlock data;
+    BinaryPreset::jsonToBinary(state, data);
+    return Napi::Buffer<uint8_t>::Copy(env, static_cast<const uint8_t*>(data.getData()), data.getSize());
+}
+
+Napi::Value PresetBinaryToJson(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1 || !info[0].IsBuffer()) {
+        Napi::TypeError::New(env, "Buffer expected").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Buffer<uint8_t> buffer = info[0].As<Napi::Buffer<uint8_t>>();
+    json state;
+    std::string error;
+    if (!BinaryPreset::binaryToJson(buffer.Data(), buffer.Length(), state, error)) {
+        Napi::Error::New(env, error).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    return Napi::String::New(env, state.dump());
+}
+
 // Initialize the module
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
     // Initialize wrapper classes
     ControlValueWrapper::Init(env, exports);
+    RenderStreamWrapper::Init(env, exports);
     SynthWrapper::Init(env, exports);
+    BatchRendererWrapper::Init(env, exports);
     
     // Add module functions with both naming conventions
     exports.Set("getModulationSources", Napi::Function::New(env, GetModulationSources));
     exports.Set("getModulationDestinations", Napi::Function::New(env, GetModulationDestinations));
     exports.Set("get_modulation_sources", Napi::Function::New(env, GetModulationSources));
     exports.Set("get_modulation_destinations", Napi::Function::New(env, GetModulationDestinations));
+    exports.Set("getWavetableCacheStats", Napi::Function::New(env, GetWavetableCacheStats));
+    exports.Set("setWavetableCacheSize", Napi::Function::New(env, SetWavetableCacheSize));
+    exports.Set("clearWavetableCache", Napi::Function::New(env, ClearWavetableCache));
+    exports.Set("presetJsonToBinary", Napi::Function::New(env, PresetJsonToBinary));
+    exports.Set("createSynths", Napi::Function::New(env, CreateSynths));
+    exports.Set("presetBinaryToJson", Napi::Function::New(env, PresetBinaryToJson));
+    exports.Set("get_wavetable_cache_stats", Napi::Function::New(env, GetWavetableCacheStats));
+    exports.Set("set_wavetable_cache_size", Napi::Function::New(env, SetWavetableCacheSize));
+    exports.Set("clear_wavetable_cache", Napi::Function::New(env, ClearWavetableCache));
+    exports.Set("preset_json_to_binary", Napi::Function::New(env, PresetJsonToBinary));
+    exports.Set("create_synths", Napi::Function::New(env, CreateSynths));
+    exports.Set("preset_binary_to_json", Napi::Function::New(env, PresetBinaryToJson));
     
     // Add constants object
     exports.Set("constants", CreateConstantsObject(env));
@@ -28,6 +28,8 @@ namespace vital {
   static constexpr float kChorusShiftAmount = 0.9f;
   static constexpr float kSampleDelayMultiplier = 0.05f;
   static constexpr float kSampleIncrementMultiplier = 0.05f;
+  // sum() adds every lane, so this averages one container on every backend.
+  static constexpr float kSumScale = 1.0f / poly_float::kSize;
 
   const poly_int Reverb::kAllpassDelays[kNetworkContainers] = {
     { 1001, 799, 933, 876 },
@@ -147,14 +149,15 @@ namespace vital {
     const mono_float* allpass_lookup3 = (mono_float*)allpass_lookups_[2].get();
     const mono_float* allpass_lookup4 = (mono_float*)allpass_lookups_[3].get();
 
-    mono_float* feedback_lookups1[] = { feedback_lookups_[0], feedback_lookups_[1],
-                                        feedback_lookups_[2], feedback_lookups_[3] };
-    mono_float* feedback_lookups2[] = { feedback_lookups_[4], feedback_lookups_[5],
-                                        feedback_lookups_[6], feedback_lookups_[7] };
-    mono_float* feedback_lookups3[] = { feedback_lookups_[8], feedback_lookups_[9],
-                                        feedback_lookups_[10], feedback_lookups_[11] };
-    mono_float* feedback_lookups4[] = { feedback_lookups_[12], feedback_lookups_[13],
-                                        feedback_lookups_[14], feedback_lookups_[15] };
+    mono_float* feedback_lookups[kNetworkContainers][poly_float::kSize];
+    for (int c = 0; c < kNetworkContainers; ++c) {
+      for (int i = 0; i < poly_float::kSize; ++i)
+        feedback_lookups[c][i] = feedback_lookups_[c * kContainerSize + i % kContainerSize];
+    }
+    mono_float** feedback_lookups1 = feedback_lookups[0];
+    mono_float** feedback_lookups2 = feedback_lookups[1];
+    mono_float** feedback_lookups3 = feedback_lookups[2];
+    mono_float** feedback_lookups4 = feedback_lookups[3];
 
     poly_float size = utils::clamp(input(kSize)->at(0), 0.0f, 1.0f);
     poly_float size_mult = futils::pow(2.0f, size * kSizePowerRange + kMinSizePower);
@@ -204,10 +207,10 @@ namespace vital {
 
     poly_float current_chorus_amount = chorus_amount_;
     chorus_amount_ = utils::clamp(input(kChorusAmount)->at(0)[0], 0.0f, 1.0f) * kMaxChorusDrift * sample_rate_ratio;
-    chorus_amount_ = utils::min(chorus_amount_, delay1 - 8 * poly_float::kSize);
-    chorus_amount_ = utils::min(chorus_amount_, delay2 - 8 * poly_float::kSize);
-    chorus_amount_ = utils::min(chorus_amount_, delay3 - 8 * poly_float::kSize);
-    chorus_amount_ = utils::min(chorus_amount_, delay4 - 8 * poly_float::kSize);
+    chorus_amount_ = utils::min(chorus_amount_, delay1 - 8 * kContainerSize);
+    chorus_amount_ = utils::min(chorus_amount_, delay2 - 8 * kContainerSize);
+    chorus_amount_ = utils::min(chorus_amount_, delay3 - 8 * kContainerSize);
+    chorus_amount_ = utils::min(chorus_amount_, delay4 - 8 * kContainerSize);
     poly_float delta_chorus_amount = (chorus_amount_ - current_chorus_amount) * tick_increment;
     current_chorus_amount = current_chorus_amount * size_mult;
 
@@ -262,7 +265,7 @@ namespace vital {
       poly_float allpass_output4 = allpass_read4 + allpass_delay_input4 * kAllpassFeedback;
 
       poly_float total_rows = allpass_output1 + allpass_output2 + allpass_output3 + allpass_output4;
-      poly_float other_feedback = poly_float::mulAdd(total_rows.sum() * 0.25f, total_rows, -0.5f);
+      poly_float other_feedback = poly_float::mulAdd(total_rows.sum() * kSumScale, total_rows, -0.5f);
 
       poly_float write1 = other_feedback + allpass_output1;
       poly_float write2 = other_feedback + allpass_output2;
@@ -323,7 +326,7 @@ namespace vital {
       write_index_ = (write_index_ + 1) & feedback_mask_;
 
       poly_float total_allpass = store1 + store2 + store3 + store4;
-      poly_float other_feedback_allpass = poly_float::mulAdd(total_allpass.sum() * 0.25f, total_allpass, -0.5f);
+      poly_float other_feedback_allpass = poly_float::mulAdd(total_allpass.sum() * kSumScale, total_allpass, -0.5f);
 
       poly_float feed_forward1 = other_feedback_allpass + store1;
       poly_float feed_forward2 = other_feedback_allpass + store2;
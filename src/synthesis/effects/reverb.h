@@ -35,7 +35,9 @@ namespace vital {
       static constexpr int kBaseFeedbackBits = 14;
       static constexpr int kExtraLookupSample = 4;
       static constexpr int kBaseAllpassBits = 10;
-      static constexpr int kNetworkContainers = kNetworkSize / poly_float::kSize;
+      // Each container holds four network nodes. AVX2 runs the same nodes in both of its lane groups.
+      static constexpr int kContainerSize = 4;
+      static constexpr int kNetworkContainers = kNetworkSize / kContainerSize;
       static constexpr int kMinSizePower = -3;
       static constexpr int kMaxSizePower = 1;
       static constexpr float kSizePowerRange = kMaxSizePower - kMinSizePower;
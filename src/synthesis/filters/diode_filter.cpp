@@ -30,6 +30,7 @@ namespace vital {
     stage2_.reset(reset_mask);
     stage3_.reset(reset_mask);
     stage4_.reset(reset_mask);
+    high_pass_feedback_.reset(reset_mask);
   }
 
   void DiodeFilter::hardReset() {
@@ -0,0 +1,70 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "json/json.h"
+
+#include <algorithm>
+#include <cstring>
+
+using json = nlohmann::json;
+
+namespace vital {
+
+  // Audio fields in preset json are base64 strings. Binary presets load with references to their
+  // raw blocks instead, which are only valid while the preset data is, so nothing may keep them.
+  namespace audio_block {
+    constexpr char kReferenceKey[] = "binary_block";
+
+    inline json reference(const void* data, size_t size) {
+      json block;
+      block[kReferenceKey] = { static_cast<uint64_t>(reinterpret_cast<uintptr_t>(data)),
+                               static_cast<uint64_t>(size) };
+      return block;
+    }
+
+    inline bool isReference(const json& field) {
+      return field.is_object() && field.count(kReferenceKey);
+    }
+
+    // Returns the bytes of _field_, decoding into _decoded_ only if it's base64.
+    inline const void* read(const json& field, MemoryOutputStream& decoded, size_t& size) {
+      if (isReference(field)) {
+        const json& block = field[kReferenceKey];
+        size = static_cast<size_t>(block[1].get<uint64_t>());
+        return reinterpret_cast<const void*>(static_cast<uintptr_t>(block[0].get<uint64_t>()));
+      }
+
+      if (field.is_string())
+        Base64::convertFromBase64(decoded, field.get<std::string>());
+      size = decoded.getDataSize();
+      return decoded.getData();
+    }
+
+    // Copies _size_ bytes of _field_ into _destination_, zero filling anything the field is missing.
+    inline void copy(const json& field, void* destination, size_t size) {
+      MemoryOutputStream decoded;
+      size_t available = 0;
+      const void* data = read(field, decoded, available);
+      size_t copy_size = std::min(size, available);
+      if (copy_size)
+        memcpy(destination, data, copy_size);
+      memset(static_cast<char*>(destination) + copy_size, 0, size - copy_size);
+    }
+  } // namespace audio_block
+} // namespace vital
@@ -161,6 +161,27 @@ namespace vital {
     #endif
     }
 
+  #if VITAL_AVX2
+    // Loads four values for each group of voices. The transpose then hands each lane its own four values.
+    force_inline poly_float toPolyFloatFromUnaligned(const mono_float* first_group,
+                                                     const mono_float* second_group) {
+      return _mm256_set_m128(_mm_loadu_ps(second_group), _mm_loadu_ps(first_group));
+    }
+
+    force_inline matrix getValueMatrix(const mono_float* buffer, poly_int indices) {
+      return matrix(toPolyFloatFromUnaligned(buffer + indices[0], buffer + indices[4]),
+                    toPolyFloatFromUnaligned(buffer + indices[1], buffer + indices[5]),
+                    toPolyFloatFromUnaligned(buffer + indices[2], buffer + indices[6]),
+                    toPolyFloatFromUnaligned(buffer + indices[3], buffer + indices[7]));
+    }
+
+    force_inline matrix getValueMatrix(const mono_float* const* buffers, poly_int indices) {
+      return matrix(toPolyFloatFromUnaligned(buffers[0] + indices[0], buffers[4] + indices[4]),
+                    toPolyFloatFromUnaligned(buffers[1] + indices[1], buffers[5] + indices[5]),
+                    toPolyFloatFromUnaligned(buffers[2] + indices[2], buffers[6] + indices[6]),
+                    toPolyFloatFromUnaligned(buffers[3] + indices[3], buffers[7] + indices[7]));
+    }
+  #else
     force_inline matrix getValueMatrix(const mono_float* buffer, poly_int indices) {
       return matrix(toPolyFloatFromUnaligned(buffer + indices[0]),
                     toPolyFloatFromUnaligned(buffer + indices[1]),
@@ -174,6 +195,7 @@ namespace vital {
                     toPolyFloatFromUnaligned(buffers[2] + indices[2]),
                     toPolyFloatFromUnaligned(buffers[3] + indices[3]));
     }
+  #endif
 
     force_inline poly_float interpolate(poly_float from, poly_float to, poly_float t) {
       return mulAdd(from, to - from, t);
@@ -287,7 +309,7 @@ namespace vital {
 
     force_inline poly_int swapVoices(poly_int value) {
     #if VITAL_AVX2
-      return _mm256_shuffle_epi32(value.value, value.value, _MM_SHUFFLE(1, 0, 3, 2));
+      return _mm256_shuffle_epi32(value.value, _MM_SHUFFLE(1, 0, 3, 2));
     #elif VITAL_SSE2
       return _mm_shuffle_epi32(value.value, _MM_SHUFFLE(1, 0, 3, 2));
     #elif VITAL_NEON
@@ -295,6 +317,32 @@ namespace vital {
     #endif
     }
 
+    // AVX2 swaps its two groups of voices. The four lane backends have a single group and return it as is.
+    force_inline poly_float swapVoiceGroups(poly_float value) {
+    #if VITAL_AVX2
+      return _mm256_permute2f128_ps(value.value, value.value, 1);
+    #else
+      return value;
+    #endif
+    }
+
+    force_inline poly_int swapVoiceGroups(poly_int value) {
+    #if VITAL_AVX2
+      return _mm256_permute2x128_si256(value.value, value.value, 1);
+    #else
+      return value;
+    #endif
+    }
+
+    // Adds every voice in the vector so each voice holds the total.
+    force_inline poly_float sumVoices(poly_float value) {
+      value += swapVoices(value);
+    #if VITAL_AVX2
+      value += swapVoiceGroups(value);
+    #endif
+      return value;
+    }
+
     force_inline poly_float swapInner(poly_float value) {
     #if VITAL_AVX2
       return _mm256_shuffle_ps(value.value, value.value, _MM_SHUFFLE(3, 1, 2, 0));
@@ -337,18 +385,30 @@ namespace vital {
     #endif
     }
 
+    // Copies the first stereo voice into every voice.
+    force_inline poly_float broadcastFirstVoice(poly_float value) {
+      poly_float first_voice = compactFirstVoices(value, value);
+    #if VITAL_AVX2
+      return _mm256_permute2f128_ps(first_voice.value, first_voice.value, 0);
+    #else
+      return first_voice;
+    #endif
+    }
+
     force_inline poly_float sumSplitAudio(poly_float sum) {
       poly_float totals = sum + utils::swapStereo(sum);
       return utils::swapInner(totals);
     }
 
     force_inline mono_float maxFloat(poly_float values) {
+      values = utils::max(values, swapVoiceGroups(values));
       poly_float swap_voices = swapVoices(values);
       poly_float max_voice = utils::max(values, swap_voices);
       return utils::max(max_voice, utils::swapStereo(max_voice))[0];
     }
 
     force_inline mono_float minFloat(poly_float values) {
+      values = utils::min(values, swapVoiceGroups(values));
       poly_float swap_voices = swapVoices(values);
       poly_float min_voice = utils::min(values, swap_voices);
       return utils::min(min_voice, utils::swapStereo(min_voice))[0];
@@ -565,7 +625,7 @@ namespace vital {
     template<size_t shift>
     force_inline poly_int shiftRight(poly_int integer) {
     #if VITAL_AVX2
-      return _mm256_srli_epi32(integers.value, shift);
+      return _mm256_srli_epi32(integer.value, shift);
     #elif VITAL_SSE2
       return _mm_srli_epi32(integer.value, shift);
     #elif VITAL_NEON
@@ -576,7 +636,7 @@ namespace vital {
     template<size_t shift>
     force_inline poly_int shiftLeft(poly_int integer) {
     #if VITAL_AVX2
-      return _mm256_slli_epi32(integers.value, shift);
+      return _mm256_slli_epi32(integer.value, shift);
     #elif VITAL_SSE2
       return _mm_slli_epi32(integer.value, shift);
     #elif VITAL_NEON
@@ -20,9 +20,13 @@
 #include <climits>
 #include <cstdlib>
 
+// AVX2 is opt in at build time with VITAL_AVX2=1 and packs eight lanes per vector. The lanes are two
+// groups of four laid out like SSE2, two stereo voices each. Four value constructors fill both groups.
 #if VITAL_AVX2
   #define VITAL_AVX2 1
-  static_assert(false, "AVX2 is not supported yet.");
+  #if !defined(__AVX2__)
+    static_assert(false, "VITAL_AVX2 needs the compiler to target AVX2 (-mavx2 or /arch:AVX2).");
+  #endif
 #elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
   #define VITAL_SSE2 1
 #elif defined(__ARM_NEON__) || defined(__ARM_NEON)
@@ -31,7 +35,7 @@
   static_assert(false, "No SIMD Intrinsics found which are necessary for compilation");
 #endif
 
-#if VITAL_SSE2
+#if VITAL_AVX2 || VITAL_SSE2
   #include <immintrin.h>
 #elif VITAL_NEON
   #include <arm_neon.h>
@@ -86,7 +90,7 @@ namespace vital {
 
     static force_inline simd_type vector_call load(const uint32_t* memory) {
 #if VITAL_AVX2
-      return _mm256_loadu_si256((const __m256i*)scalar);
+      return _mm256_loadu_si256((const __m256i*)memory);
 #elif VITAL_SSE2
       return _mm_loadu_si128((const __m128i*)memory);
 #elif VITAL_NEON
@@ -126,7 +130,7 @@ namespace vital {
 
     static force_inline simd_type vector_call mul(simd_type one, simd_type two) {
 #if VITAL_AVX2
-      return _mm256_mul_epi32(one, two);
+      return _mm256_mullo_epi32(one, two);
 #elif VITAL_SSE2
       simd_type mul0_2 = _mm_mul_epu32(one, two);
       simd_type mul1_3 = _mm_mul_epu32(_mm_shuffle_epi32(one, _MM_SHUFFLE(2, 3, 0, 1)),
@@ -174,7 +178,7 @@ namespace vital {
 
     static force_inline simd_type vector_call max(simd_type one, simd_type two) {
 #if VITAL_AVX2
-      return _mm256_max_epi32(one, two);
+      return _mm256_max_epu32(one, two);
 #elif VITAL_SSE2
       simd_type greater_than_mask = greaterThan(one, two);
       return _mm_or_si128(_mm_and_si128(greater_than_mask, one), _mm_andnot_si128(greater_than_mask, two));
@@ -216,10 +220,11 @@ namespace vital {
 
     static force_inline uint32_t vector_call sum(simd_type value) {
 #if VITAL_AVX2
-      simd_type flip = _mm256_permute4x64_epi64(value, _MM_SHUFFLE(1, 0, 3, 2))
-      simd_type sum = _mm256_hadd_epi32(value, flip);
-      sum = _mm256_hadd_epi32(sum, sum);
-      return _mm256_cvtsi256_si32(sum);
+      simd_scalar_union union_value { value };
+      uint32_t total = 0;
+      for (int i = 0; i < kSize; ++i)
+        total += union_value.scalar[i];
+      return total;
 #elif VITAL_SSE2
       simd_scalar_union union_value { value };
       uint32_t total = 0;
@@ -278,17 +283,30 @@ namespace vital {
     }
 
     force_inline poly_int(uint32_t first, uint32_t second, uint32_t third, uint32_t fourth) noexcept {
+#if VITAL_AVX2
+      scalar_simd_union union_value { (int32_t)first, (int32_t)second, (int32_t)third, (int32_t)fourth,
+                                      (int32_t)first, (int32_t)second, (int32_t)third, (int32_t)fourth };
+#else
       scalar_simd_union union_value { (int32_t)first, (int32_t)second, (int32_t)third, (int32_t)fourth };
+#endif
       value = union_value.simd;
     }
 
+#if VITAL_AVX2
+    force_inline poly_int(uint32_t first, uint32_t second) noexcept {
+      scalar_simd_union union_value { (int32_t)first, (int32_t)second, (int32_t)first, (int32_t)second,
+                                      (int32_t)first, (int32_t)second, (int32_t)first, (int32_t)second };
+      value = union_value.simd;
+    }
+#else
     force_inline poly_int(uint32_t first, uint32_t second) noexcept : poly_int(first, second, first, second) { }
+#endif
 
     force_inline ~poly_int() noexcept { }
 
     force_inline uint32_t vector_call access(size_t index) const noexcept {
 #if VITAL_AVX2
-      simd_union union_value { value };
+      simd_scalar_union union_value { value };
       return union_value.scalar[index];
 #elif VITAL_SSE2
       simd_scalar_union union_value { value };
@@ -300,7 +318,7 @@ namespace vital {
 
     force_inline void vector_call set(size_t index, uint32_t new_value) noexcept {
 #if VITAL_AVX2
-      simd_union union_value { value };
+      simd_scalar_union union_value { value };
       union_value.scalar[index] = new_value;
       value = union_value.simd;
 #elif VITAL_SSE2
@@ -491,7 +509,7 @@ namespace vital {
 
     static force_inline simd_type vector_call load(const float* memory) {
 #if VITAL_AVX2
-      return _mm256_loadu_ps(&scalar);
+      return _mm256_loadu_ps(memory);
 #elif VITAL_SSE2
       return _mm_loadu_ps(memory);
 #elif VITAL_NEON
@@ -541,7 +559,7 @@ namespace vital {
 
     static force_inline simd_type vector_call mulScalar(simd_type value, float scalar) {
 #if VITAL_AVX2
-      return _mm256_mul_ps(value, _mm_set1_ps(scalar));
+      return _mm256_mul_ps(value, _mm256_set1_ps(scalar));
 #elif VITAL_SSE2
       return _mm_mul_ps(value, _mm_set1_ps(scalar));
 #elif VITAL_NEON
@@ -551,7 +569,7 @@ namespace vital {
 
     static force_inline simd_type vector_call mulAdd(simd_type one, simd_type two, simd_type three) {
 #if VITAL_AVX2
-      return _mm256_fmadd_ps(two, three, one);
+      return _mm256_add_ps(one, _mm256_mul_ps(two, three));
 #elif VITAL_SSE2
       return _mm_add_ps(one, _mm_mul_ps(two, three));
 #elif VITAL_NEON
@@ -565,7 +583,7 @@ namespace vital {
 
     static force_inline simd_type vector_call mulSub(simd_type one, simd_type two, simd_type three) {
 #if VITAL_AVX2
-      return _mm256_fsub_ps(two, three, one);
+      return _mm256_sub_ps(one, _mm256_mul_ps(two, three));
 #elif VITAL_SSE2
       return _mm_sub_ps(one, _mm_mul_ps(two, three));
 #elif VITAL_NEON
@@ -658,7 +676,7 @@ namespace vital {
 
     static force_inline mask_simd_type vector_call equal(simd_type one, simd_type two) {
 #if VITAL_AVX2
-      return toMask(_mm256_cmpeq_ps(one, two, _CMP_EQ_OQ));
+      return toMask(_mm256_cmp_ps(one, two, _CMP_EQ_OQ));
 #elif VITAL_SSE2
       return toMask(_mm_cmpeq_ps(one, two));
 #elif VITAL_NEON
@@ -688,7 +706,7 @@ namespace vital {
 
     static force_inline mask_simd_type vector_call notEqual(simd_type one, simd_type two) {
 #if VITAL_AVX2
-      return toMask(_mm256_cmp_ps(one, two, _CMP_NEQ_OQ));
+      return toMask(_mm256_cmp_ps(one, two, _CMP_NEQ_UQ));
 #elif VITAL_SSE2
       return toMask(_mm_cmpneq_ps(one, two));
 #elif VITAL_NEON
@@ -700,10 +718,11 @@ namespace vital {
 
     static force_inline float vector_call sum(simd_type value) {
 #if VITAL_AVX2
-      simd_type flip = _mm256_permute2f128_ps(value, value, 1)
-      simd_type sum = _mm256_hadd_ps(value, flip);
-      sum = _mm256_hadd_ps(sum, sum);
-      return _mm256_cvtss_f32(sum);
+      __m128 half = _mm_add_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1));
+      __m128 flip = _mm_shuffle_ps(half, half, _MM_SHUFFLE(1, 0, 3, 2));
+      __m128 sum = _mm_add_ps(half, flip);
+      __m128 swap = _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(2, 3, 0, 1));
+      return _mm_cvtss_f32(_mm_add_ps(sum, swap));
 #elif VITAL_SSE2
       simd_type flip = _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 0, 3, 2));
       simd_type sum = _mm_add_ps(value, flip);
@@ -719,7 +738,15 @@ namespace vital {
     static force_inline void vector_call transpose(simd_type& row0, simd_type& row1,
                                                    simd_type& row2, simd_type& row3) {
 #if VITAL_AVX2
-      static_assert(false, "AVX2 transpose not supported yet");
+      // Transposes each 128 bit half on its own, the same as two SSE2 transposes.
+      __m256 low0 = _mm256_unpacklo_ps(row0, row1);
+      __m256 low1 = _mm256_unpacklo_ps(row2, row3);
+      __m256 high0 = _mm256_unpackhi_ps(row0, row1);
+      __m256 high1 = _mm256_unpackhi_ps(row2, row3);
+      row0 = _mm256_shuffle_ps(low0, low1, _MM_SHUFFLE(1, 0, 1, 0));
+      row1 = _mm256_shuffle_ps(low0, low1, _MM_SHUFFLE(3, 2, 3, 2));
+      row2 = _mm256_shuffle_ps(high0, high1, _MM_SHUFFLE(1, 0, 1, 0));
+      row3 = _mm256_shuffle_ps(high0, high1, _MM_SHUFFLE(3, 2, 3, 2));
 #elif VITAL_SSE2
       __m128 low0 = _mm_unpacklo_ps(row0, row1);
       __m128 low1 = _mm_unpacklo_ps(row2, row3);
@@ -795,12 +822,21 @@ namespace vital {
     force_inline poly_float(float initial_value) noexcept { value = init(initial_value); }
 
     force_inline poly_float(float initial_value1, float initial_value2) noexcept {
+#if VITAL_AVX2
+      scalar_simd_union union_value { initial_value1, initial_value2, initial_value1, initial_value2,
+                                      initial_value1, initial_value2, initial_value1, initial_value2 };
+#else
       scalar_simd_union union_value { initial_value1, initial_value2, initial_value1, initial_value2 };
+#endif
       value = union_value.simd;
     }
 
     force_inline poly_float(float first, float second, float third, float fourth) noexcept {
+#if VITAL_AVX2
+      scalar_simd_union union_value { first, second, third, fourth, first, second, third, fourth };
+#else
       scalar_simd_union union_value { first, second, third, fourth };
+#endif
       value = union_value.simd;
     }
 
@@ -808,7 +844,7 @@ namespace vital {
 
     force_inline float vector_call access(size_t index) const noexcept {
 #if VITAL_AVX2
-      simd_union union_value { value };
+      simd_scalar_union union_value { value };
       return union_value.scalar[index];
 #elif VITAL_SSE2
       simd_scalar_union union_value { value };
@@ -820,7 +856,7 @@ namespace vital {
 
     force_inline void vector_call set(size_t index, float new_value) noexcept {
 #if VITAL_AVX2
-      simd_union union_value { value };
+      simd_scalar_union union_value { value };
       union_value.scalar[index] = new_value;
       value = union_value.simd;
 #elif VITAL_SSE2
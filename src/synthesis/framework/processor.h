@@ -153,6 +153,9 @@ namespace vital {
       // Override this to handle state resetting when the Processor is turned off/on.
       virtual void hardReset() { reset(poly_mask(-1)); }
 
+      // Override this to restart any random generators from _seed_ so renders can be reproduced.
+      virtual void setRandomSeed(int seed) { }
+
       bool initialized() { return state_->initialized; }
 
       // Subclasses should override this if they need to adjust for change in
@@ -204,15 +207,14 @@ namespace vital {
       force_inline void clearOutputBufferForReset(poly_mask reset_mask, int input_index, int output_index) const {
         poly_float* audio_out = output(output_index)->buffer;
         poly_int trigger_offset = input(input_index)->source->trigger_offset & reset_mask;
-        int num_samples_first = trigger_offset[0];
-        poly_int mask(0, 0, -1, -1);
-        for (int i = 0; i < num_samples_first; ++i)
-          audio_out[i] = audio_out[i] & mask;
-
-        mask = poly_int(-1, -1, 0, 0);
-        int num_samples_second = trigger_offset[2];
-        for (int i = 0; i < num_samples_second; ++i)
-          audio_out[i] = audio_out[i] & mask;
+        for (int v = 0; v < poly_int::kSize; v += 2) {
+          poly_int mask(-1);
+          mask.set(v, 0);
+          mask.set(v + 1, 0);
+          int num_samples = trigger_offset[v];
+          for (int i = 0; i < num_samples; ++i)
+            audio_out[i] = audio_out[i] & mask;
+        }
       }
 
       bool inputMatchesBufferSize(int input = 0);
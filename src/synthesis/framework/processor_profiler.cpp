@@ -0,0 +1,61 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "processor_profiler.h"
+
+namespace vital {
+
+  thread_local ProcessorProfiler* ProcessorProfiler::active_ = nullptr;
+
+  ProcessorProfiler::ProcessorProfiler() : last_time_(0), start_cycles_(0), total_cycles_(0), total_seconds_(0.0) {
+    root_ = entry(kRootName);
+    current_ = root_;
+  }
+
+  ProcessorProfiler::Entry* ProcessorProfiler::entry(const std::string& name) {
+    return &entries_[name];
+  }
+
+  void ProcessorProfiler::reset() {
+    for (auto& entry : entries_)
+      entry.second = Entry();
+
+    total_cycles_ = 0;
+    total_seconds_ = 0.0;
+  }
+
+  void ProcessorProfiler::report(std::vector<Report>& reports) const {
+    double seconds_per_cycle = total_cycles_ ? total_seconds_ / total_cycles_ : 0.0;
+    for (auto& entry : entries_) {
+      if (entry.second.cycles || entry.second.calls)
+        reports.push_back({ entry.first, entry.second.cycles, entry.second.calls,
+                            entry.second.cycles * seconds_per_cycle });
+    }
+  }
+
+  void ProcessorProfiler::start() {
+    current_ = root_;
+    start_time_ = std::chrono::steady_clock::now();
+    last_time_ = now();
+    start_cycles_ = last_time_;
+  }
+
+  void ProcessorProfiler::stop() {
+    switchTo(root_);
+    total_cycles_ += last_time_ - start_cycles_;
+    total_seconds_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time_).count();
+  }
+} // namespace vital
@@ -0,0 +1,135 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common.h"
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#if VITAL_AVX2 || VITAL_SSE2
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+  #else
+    #include <x86intrin.h>
+  #endif
+#endif
+
+namespace vital {
+
+  // Charges the time spent in the processor graph to the named SynthModule that is running. Modules switch
+  // the profiler to their group when they start processing, and a router switches back to its own group when
+  // a child returns, so every group gets exclusive time. Unnamed modules count toward the group they run in.
+  // Profiling is per thread: a ProcessorProfiler only sees processing done under its Scope.
+  class ProcessorProfiler {
+    public:
+      static constexpr char kRootName[] = "engine";
+
+      struct Entry {
+        Entry() : cycles(0), calls(0) { }
+
+        uint64_t cycles;
+        uint64_t calls;
+      };
+
+      struct Report {
+        std::string name;
+        uint64_t cycles;
+        uint64_t calls;
+        double seconds;
+      };
+
+      // Makes _profiler_ the active profiler on this thread for its lifetime. A null profiler does nothing.
+      class Scope {
+        public:
+          Scope(ProcessorProfiler* profiler) : profiler_(profiler), previous_(active_) {
+            if (profiler_) {
+              active_ = profiler_;
+              profiler_->start();
+            }
+          }
+
+          ~Scope() {
+            if (profiler_) {
+              profiler_->stop();
+              active_ = previous_;
+            }
+          }
+
+        private:
+          ProcessorProfiler* profiler_;
+          ProcessorProfiler* previous_;
+      };
+
+      // CPU cycles on x86, nanoseconds elsewhere.
+      static force_inline uint64_t now() {
+#if VITAL_AVX2 || VITAL_SSE2
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+      }
+
+      static force_inline ProcessorProfiler* active() { return active_; }
+
+      ProcessorProfiler();
+
+      // Entries are never erased, so the pointer stays valid for the life of the profiler.
+      Entry* entry(const std::string& name);
+
+      force_inline Entry* current() const { return current_; }
+
+      force_inline void switchTo(Entry* entry) {
+        uint64_t time = now();
+        current_->cycles += time - last_time_;
+        last_time_ = time;
+        current_ = entry;
+      }
+
+      // Called by a router after each child it runs.
+      force_inline void processed(Entry* entry) {
+        entry->calls++;
+        if (current_ != entry)
+          switchTo(entry);
+      }
+
+      void reset();
+      // Appends the non-empty groups, with seconds estimated from the wall time spent under a Scope.
+      void report(std::vector<Report>& reports) const;
+
+    private:
+      void start();
+      void stop();
+
+      static thread_local ProcessorProfiler* active_;
+
+      std::map<std::string, Entry> entries_;
+      Entry* root_;
+      Entry* current_;
+      uint64_t last_time_;
+      uint64_t start_cycles_;
+      uint64_t total_cycles_;
+      std::chrono::steady_clock::time_point start_time_;
+      double total_seconds_;
+
+      JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ProcessorProfiler)
+  };
+} // namespace vital
@@ -31,9 +31,12 @@ namespace vital {
       local_order_(kMaxModulationConnections),
       global_feedback_order_(new std::vector<const Feedback*>()),
       global_changes_(new int(0)), local_changes_(0),
-      dependencies_(new CircularQueue<const Processor*>(kMaxModulationConnections)),
-      dependencies_visited_(new CircularQueue<const Processor*>(kMaxModulationConnections)),
-      dependency_inputs_(new CircularQueue<const Processor*>(kMaxModulationConnections)) { }
+      dependencies_(new std::unordered_set<const Processor*>()),
+      dependencies_visited_(new std::unordered_set<const Processor*>()),
+      dependency_inputs_(new CircularQueue<const Processor*>(kMaxModulationConnections)) {
+    dependencies_->reserve(kMaxModulationConnections);
+    dependencies_visited_->reserve(kMaxModulationConnections);
+  }
 
   ProcessorRouter::ProcessorRouter(const ProcessorRouter& original) :
       Processor(original), global_order_(original.global_order_), global_reorder_(original.global_reorder_),
@@ -67,6 +70,13 @@ namespace vital {
     if (shouldUpdate())
       updateAllProcessors();
 
+    ProcessorProfiler* profiler = ProcessorProfiler::active();
+    ProcessorProfiler::Entry* profile_entry = nullptr;
+    if (profiler) {
+      profile_entry = getProfileEntry(profiler);
+      profiler->switchTo(profile_entry);
+    }
+
     // First make sure all the Feedback loops are ready to be read.
     int num_feedbacks = static_cast<int>(local_feedback_order_.size());
     for (int i = 0; i < num_feedbacks; ++i)
@@ -81,6 +91,9 @@ namespace vital {
         VITAL_ASSERT(processor->checkInputAndOutputSize(processor_samples));
         processor->process(processor_samples);
         VITAL_ASSERT(utils::isFinite(processor->output()->buffer, processor->isControlRate() ? 0 : processor_samples));
+
+        if (profiler)
+          profiler->processed(profile_entry);
       }
     }
 
@@ -112,6 +125,16 @@ namespace vital {
       local_feedback_order_[i]->setSampleRate(sample_rate);
   }
 
+  void ProcessorRouter::setRandomSeed(int seed) {
+    if (shouldUpdate())
+      updateAllProcessors();
+
+    // Children are seeded by position so the same graph gets the same seeds in every synth.
+    int num_processors = local_order_.size();
+    for (int i = 0; i < num_processors; ++i)
+      local_order_[i]->setRandomSeed(utils::RandomGenerator::deriveSeed(seed, i));
+  }
+
   void ProcessorRouter::setOversampleAmount(int oversample) {
     Processor::setOversampleAmount(oversample);
     if (shouldUpdate())
@@ -223,7 +246,7 @@ namespace vital {
 
     for (int i = 0; i < num_processors; ++i) {
       Processor* current_processor = global_order_->at(i);
-      if (current_processor != processor && dependencies_->contains(current_processor))
+      if (current_processor != processor && dependencies_->count(current_processor))
         global_reorder_->push_back(current_processor);
     }
 
@@ -232,7 +255,7 @@ namespace vital {
 
     for (int i = 0; i < num_processors; ++i) {
       Processor* current_processor = global_order_->at(i);
-      if (current_processor != processor && !dependencies_->contains(current_processor))
+      if (current_processor != processor && dependencies_->count(current_processor) == 0)
         global_reorder_->push_back(current_processor);
     }
 
@@ -245,7 +268,7 @@ namespace vital {
 
   bool ProcessorRouter::isDownstream(const Processor* first, const Processor* second) const {
     getDependencies(second);
-    return dependencies_->contains(first);
+    return dependencies_->count(first);
   }
 
   bool ProcessorRouter::areOrdered(const Processor* first, const Processor* second) const {
@@ -403,26 +426,18 @@ namespace vital {
       const Processor* dependency = getContext(dependency_inputs_->at(i));
 
       if (dependency) {
-        if (!dependencies_->contains(dependency)) {
-          dependencies_->ensureSpace();
-          dependencies_->push_back(dependency);
-        }
+        dependencies_->insert(dependency);
 
         for (int j = 0; j < dependency_inputs_->at(i)->numInputs(); ++j) {
           const Input* input = dependency_inputs_->at(i)->ownedInput(j);
-          if (input->source && input->source->owner && !dependencies_visited_->contains(input->source->owner)) {
+          if (input->source && input->source->owner && dependencies_visited_->insert(input->source->owner).second) {
             dependency_inputs_->ensureSpace();
             dependency_inputs_->push_back(input->source->owner);
-
-            if (!dependencies_visited_->contains(input->source->owner)) {
-              dependencies_visited_->ensureSpace();
-              dependencies_visited_->push_back(input->source->owner);
-            }
           }
         }
       }
     }
 
-    dependencies_->removeAll(context);
+    dependencies_->erase(context);
   }
 } // namespace vital
@@ -17,10 +17,12 @@
 #pragma once
 
 #include "processor.h"
+#include "processor_profiler.h"
 #include "circular_queue.h"
 
 #include <map>
 #include <set>
+#include <unordered_set>
 #include <vector>
 
 namespace vital {
@@ -42,6 +44,7 @@ namespace vital {
       virtual void init() override;
       virtual void setSampleRate(int sample_rate) override;
       virtual void setOversampleAmount(int oversample) override;
+      virtual void setRandomSeed(int seed) override;
 
       virtual void addProcessor(Processor* processor);
       virtual void addProcessorRealTime(Processor* processor);
@@ -61,6 +64,10 @@ namespace vital {
       virtual ProcessorRouter* getPolyRouter();
       virtual void resetFeedbacks(poly_mask reset_mask);
 
+      // The profiler group this router's own processing is charged to. Routers without a name of their own
+      // stay in the group they were called from.
+      virtual ProcessorProfiler::Entry* getProfileEntry(ProcessorProfiler* profiler) { return profiler->current(); }
+
     protected:
       // When we create a cycle into the ProcessorRouter graph, we must insert
       // a Feedback node and add it here.
@@ -103,8 +110,9 @@ namespace vital {
       std::shared_ptr<int> global_changes_;
       int local_changes_;
 
-      std::shared_ptr<CircularQueue<const Processor*>> dependencies_;
-      std::shared_ptr<CircularQueue<const Processor*>> dependencies_visited_;
+      // Hashed so building a large graph isn't quadratic in the number of processors.
+      std::shared_ptr<std::unordered_set<const Processor*>> dependencies_;
+      std::shared_ptr<std::unordered_set<const Processor*>> dependencies_visited_;
       std::shared_ptr<CircularQueue<const Processor*>> dependency_inputs_;
 
       JUCE_LEAK_DETECTOR(ProcessorRouter)
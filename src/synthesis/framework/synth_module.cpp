@@ -481,4 +481,16 @@ namespace vital {
   void SynthModule::addIdleMonoProcessor(Processor* processor) {
     getMonoRouter()->addIdleProcessor(processor);
   }
+
+  ProcessorProfiler::Entry* SynthModule::getProfileEntry(ProcessorProfiler* profiler) {
+    if (data_->name.empty())
+      return profiler->current();
+
+    // Voices share the module data, so the lookup happens once per profiler rather than once per block.
+    if (data_->profiler != profiler) {
+      data_->profiler = profiler;
+      data_->profile_entry = profiler->entry(data_->name);
+    }
+    return data_->profile_entry;
+  }
 } // namespace vital
@@ -35,8 +35,7 @@ namespace vital {
       force_inline poly_float value() const { return value_; }
 
       force_inline void update(poly_mask voice_mask) {
-        poly_float masked_value = source_->buffer[0] & voice_mask;
-        value_ = masked_value + utils::swapVoices(masked_value);
+        value_ = utils::sumVoices(source_->buffer[0] & voice_mask);
       }
 
       force_inline void update() {
@@ -55,6 +54,8 @@ namespace vital {
   };
 
   struct ModuleData {
+    ModuleData() : profiler(nullptr), profile_entry(nullptr) { }
+
     std::vector<Processor*> owned_mono_processors;
     std::vector<SynthModule*> sub_modules;
 
@@ -68,6 +69,10 @@ namespace vital {
     std::map<std::string, ValueSwitch*> mono_modulation_switches;
     std::map<std::string, ValueSwitch*> poly_modulation_switches;
 
+    std::string name;
+    ProcessorProfiler* profiler;
+    ProcessorProfiler::Entry* profile_entry;
+
     JUCE_LEAK_DETECTOR(ModuleData)
   };
 
@@ -107,6 +112,11 @@ namespace vital {
       virtual Processor* clone() const override { return new SynthModule(*this); }
       void addSubmodule(SynthModule* module) { data_->sub_modules.push_back(module); }
 
+      // Names the profiler group for this module and any unnamed modules inside it, e.g. "osc_1".
+      void setName(const std::string& name) { data_->name = name; }
+      const std::string& getName() const { return data_->name; }
+      ProcessorProfiler::Entry* getProfileEntry(ProcessorProfiler* profiler) override;
+
     protected:
       // Creates a basic linear non-scaled control.
       Value* createBaseControl(std::string name, bool audio_rate = false, bool smooth_value = false);
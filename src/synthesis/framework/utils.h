@@ -20,6 +20,7 @@
 
 #include <cmath>
 #include <complex>
+#include <atomic>
 #include <cstdlib>
 #include <random>
 
@@ -46,7 +47,15 @@ namespace vital {
 
     class RandomGenerator {
       public:
-        static int next_seed_;
+        static std::atomic<int> next_seed_;
+
+        // Spreads a base seed over many generators so each one gets its own stable stream.
+        static int deriveSeed(int seed, int index) {
+          uint32_t value = static_cast<uint32_t>(seed) * 0x9e3779b9u + static_cast<uint32_t>(index);
+          value = (value ^ (value >> 16)) * 0x85ebca6bu;
+          value = (value ^ (value >> 13)) * 0xc2b2ae35u;
+          return static_cast<int>(value ^ (value >> 16));
+        }
           
         RandomGenerator(mono_float min, mono_float max) : engine_(next_seed_++), distribution_(min, max) { }
         RandomGenerator(const RandomGenerator& other) :
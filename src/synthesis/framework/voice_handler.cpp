@@ -19,6 +19,8 @@
 #include "synth_constants.h"
 #include "utils.h"
 
+#include <algorithm>
+
 namespace vital {
 
   namespace {
@@ -75,11 +77,11 @@ namespace vital {
   }
 
   VoiceHandler::VoiceHandler(int num_outputs, int polyphony, bool control_rate) :
-      SynthModule(kNumInputs, num_outputs, control_rate), polyphony_(0), legato_(false),
+      SynthModule(kNumInputs, num_outputs, control_rate), polyphony_(0), max_polyphony_(polyphony), legato_(false),
       voice_killer_(nullptr), last_num_voices_(0), last_played_note_(-1.0f),
       sustain_(), sostenuto_(), mod_wheel_values_(), pitch_wheel_values_(), zoned_pitch_wheel_values_(),
       pressure_values_(), slide_values_(), tuning_(nullptr),
-      voice_priority_(kRoundRobin), voice_override_(kKill), total_notes_(0) {
+      voice_priority_(kRoundRobin), voice_override_(kKill), total_notes_(0), seeded_(false), seed_(0) {
     pressed_notes_.reserve(kMidiSize);
     all_voices_.reserve(kMaxPolyphony + kParallelVoices);
     free_voices_.reserve(kMaxPolyphony + kParallelVoices);
@@ -249,7 +251,7 @@ namespace vital {
       poly_float* dest = output.second->buffer;
 
       for (int i = 0; i < buffer_size; ++i)
-        dest[i] += utils::swapVoices(dest[i]);
+        dest[i] = utils::sumVoices(dest[i]);
     }
   }
 
@@ -261,10 +263,8 @@ namespace vital {
 
       VITAL_ASSERT(buffer_size == 1);
 
-      for (int i = 0; i < buffer_size; ++i) {
-        poly_float masked = source[i] & voice_mask;
-        dest[i] = masked + utils::swapVoices(masked);
-      }
+      for (int i = 0; i < buffer_size; ++i)
+        dest[i] = utils::sumVoices(source[i] & voice_mask);
     }
   }
 
@@ -273,6 +273,13 @@ namespace vital {
   }
 
   void VoiceHandler::process(int num_samples) {
+    ProcessorProfiler* profiler = ProcessorProfiler::active();
+    ProcessorProfiler::Entry* profile_entry = nullptr;
+    if (profiler) {
+      profile_entry = getProfileEntry(profiler);
+      profiler->switchTo(profile_entry);
+    }
+
     global_router_.process(num_samples);
 
     int num_voices = active_voices_.size();
@@ -297,12 +304,12 @@ namespace vital {
 
     active_aggregate_voices_.clear();
     AggregateVoice* last_aggregate_voice = nullptr;
-    int last_aggregate_index = 0;
+    poly_mask last_voice_mask = 0;
     for (Voice* active_voice : active_voices_) {
       if (active_aggregate_voices_.count(active_voice->parent()) == 0)
         active_aggregate_voices_.push_back(active_voice->parent());
       last_aggregate_voice = active_voice->parent();
-      last_aggregate_index = active_voice->voice_index();
+      last_voice_mask = active_voice->voice_mask();
     }
 
     if (last_aggregate_voice) {
@@ -310,10 +317,13 @@ namespace vital {
       active_aggregate_voices_.push_back(last_aggregate_voice);
     }
 
+    // Serial on purpose: every aggregate voice writes the same shared output buffers.
     for (AggregateVoice* aggregate_voice : active_aggregate_voices_) {
       prepareVoiceTriggers(aggregate_voice, num_samples);
       prepareVoiceValues(aggregate_voice);
       processVoice(aggregate_voice, num_samples);
+      if (profiler)
+        profiler->processed(profile_entry);
       accumulateOutputs(num_samples);
 
       // Remove voice if the right processor has a full silent buffer.
@@ -335,16 +345,14 @@ namespace vital {
     combineAccumulatedOutputs(num_samples);
 
     if (active_voices_.size()) {
-      poly_mask voice_mask = constants::kFirstMask;
-      if (last_aggregate_index)
-        voice_mask = ~voice_mask;
-
-      writeNonaccumulatedOutputs(voice_mask, num_samples);
-
-      last_played_note_ = voice_midi_->trigger_value & voice_mask;
-      last_played_note_ += utils::swapVoices(last_played_note_);
+      writeNonaccumulatedOutputs(last_voice_mask, num_samples);
+      last_played_note_ = utils::sumVoices(voice_midi_->trigger_value & last_voice_mask);
     }
 
+    // Voices cloned under a higher polyphony are freed once they're done playing.
+    if (getNumAllocatedVoices() > voiceLimit())
+      trimVoices(voiceLimit());
+
     last_num_voices_ = num_voices;
   }
 
@@ -362,6 +370,17 @@ namespace vital {
       aggregate_voice->processor->setSampleRate(sample_rate);
   }
 
+  void VoiceHandler::setRandomSeed(int seed) {
+    ProcessorRouter::setRandomSeed(seed);
+    global_router_.setRandomSeed(utils::RandomGenerator::deriveSeed(seed, -1));
+
+    seeded_ = true;
+    seed_ = seed;
+    int num_aggregate_voices = static_cast<int>(all_aggregate_voices_.size());
+    for (int i = 0; i < num_aggregate_voices; ++i)
+      all_aggregate_voices_[i]->processor->setRandomSeed(utils::RandomGenerator::deriveSeed(seed_, i));
+  }
+
   int VoiceHandler::getNumActiveVoices() {
     return active_voices_.size();
   }
@@ -495,11 +514,8 @@ namespace vital {
   }
 
   poly_mask VoiceHandler::getCurrentVoiceMask() {
-    if (active_voices_.size()) {
-      if (active_voices_.back()->voice_index())
-        return ~constants::kFirstMask;
-      return constants::kFirstMask;
-    }
+    if (active_voices_.size())
+      return active_voices_.back()->voice_mask();
 
     return 0;
   }
@@ -528,6 +544,10 @@ namespace vital {
   }
 
   Voice* VoiceHandler::grabFreeVoice() {
+    // Voices are cloned on demand so a synth that only ever plays one note only pays for one voice.
+    if (free_voices_.size() == 0 && getNumAllocatedVoices() < voiceLimit())
+      addParallelVoices();
+
     Voice* voice = nullptr;
     if (free_voices_.size()) {
       voice = free_voices_.front();
@@ -536,6 +556,17 @@ namespace vital {
     return voice;
   }
 
+  int VoiceHandler::voiceLimit() const {
+    // With the kill override a stolen voice fades out while the voice that replaced it starts,
+    // so every voice inside the polyphony can briefly need a second one.
+    int limit = polyphony_;
+    if (voice_override_ == kKill && !legato_)
+      limit += polyphony_;
+
+    limit = std::min(limit, max_polyphony_);
+    return (limit + kParallelVoices - 1) / kParallelVoices * kParallelVoices;
+  }
+
   Voice* VoiceHandler::grabFreeParallelVoice() {
     for (auto& aggregate_voice : all_aggregate_voices_) {
       Voice* dead_voice = nullptr;
@@ -766,8 +797,7 @@ namespace vital {
   }
 
   void VoiceHandler::setPolyphony(int polyphony) {
-    while (all_voices_.size() < polyphony)
-      addParallelVoices();
+    max_polyphony_ = std::max(max_polyphony_, polyphony);
 
     int num_voices_to_kill = active_voices_.size() - polyphony;
     for (int i = 0; i < num_voices_to_kill; ++i) {
@@ -779,6 +809,33 @@ namespace vital {
     polyphony_ = polyphony;
   }
 
+  int VoiceHandler::trimVoices(int max_voices) {
+    int num_removed = 0;
+    for (int i = static_cast<int>(all_aggregate_voices_.size()) - 1; i >= 0; --i) {
+      if (getNumAllocatedVoices() <= max_voices)
+        break;
+
+      AggregateVoice* aggregate_voice = all_aggregate_voices_[i].get();
+      bool free = true;
+      for (Voice* single_voice : aggregate_voice->voices)
+        free = free && free_voices_.contains(single_voice);
+
+      if (!free)
+        continue;
+
+      for (Voice* single_voice : aggregate_voice->voices) {
+        free_voices_.remove(single_voice);
+        all_voices_.erase(std::find_if(all_voices_.begin(), all_voices_.end(),
+                                       [=](const std::unique_ptr<Voice>& voice) { return voice.get() == single_voice; }));
+        num_removed++;
+      }
+      all_aggregate_voices_.erase(all_aggregate_voices_.begin() + i);
+    }
+
+    active_aggregate_voices_.clear();
+    return num_removed;
+  }
+
   mono_float VoiceHandler::getLastActiveNote() const {
     if (active_voices_.size())
       return active_voices_.back()->state().tuned_note;
@@ -881,6 +938,10 @@ namespace vital {
     std::unique_ptr<AggregateVoice> aggregate_voice = std::make_unique<AggregateVoice>();
     aggregate_voice->processor = std::unique_ptr<Processor>(voice_router_.clone());
     aggregate_voice->processor->process(1);
+    if (seeded_) {
+      int index = static_cast<int>(all_aggregate_voices_.size());
+      aggregate_voice->processor->setRandomSeed(utils::RandomGenerator::deriveSeed(seed_, index));
+    }
     aggregate_voice->voices.reserve(kParallelVoices);
 
     for (int i = 0; i < kParallelVoices; ++i) {
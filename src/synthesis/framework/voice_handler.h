@@ -24,6 +24,7 @@
 
 #include <map>
 #include <list>
+#include <vector>
 
 namespace vital {
 
@@ -239,6 +240,9 @@ namespace vital {
       AggregateVoice* parent_;
   };
 
+  // Each AggregateVoice owns a clone of the voice router, but clones share their Input and Output objects
+  // with the original processors. Aggregate voices must be processed one at a time and their outputs
+  // accumulated before the next one runs, so they can't be spread across threads.
   struct AggregateVoice {
     CircularQueue<Voice*> voices;
     std::unique_ptr<Processor> processor;
@@ -283,6 +287,7 @@ namespace vital {
       virtual void process(int num_samples) override;
       virtual void init() override;
       virtual void setSampleRate(int sample_rate) override;
+      virtual void setRandomSeed(int seed) override;
       void setTuning(const Tuning* tuning) { tuning_ = tuning; }
 
       int getNumActiveVoices();
@@ -362,6 +367,7 @@ namespace vital {
       force_inline Output* mod_wheel() { return &mod_wheel_; }
       force_inline Output* getAccumulatedOutput(Output* output) { return accumulated_outputs_[output].get(); }
       force_inline int polyphony() { return polyphony_; }
+      force_inline int getNumAllocatedVoices() const { return static_cast<int>(all_voices_.size()); }
     
       mono_float getLastActiveNote() const;
 
@@ -379,6 +385,8 @@ namespace vital {
       Output* registerOutput(Output* output, int index) override;
 
       void setPolyphony(int polyphony);
+      // Frees every pair of voices that are both free.
+      int trimVoices() { return trimVoices(0); }
 
       force_inline void setVoiceKiller(const Output* killer) {
         voice_killer_ = killer;
@@ -417,6 +425,8 @@ namespace vital {
     private:
       Voice* grabVoice();
       Voice* grabFreeVoice();
+      int voiceLimit() const;
+      int trimVoices(int max_voices);
       Voice* grabFreeParallelVoice();
       Voice* grabVoiceOfType(Voice::KeyState key_state);
       Voice* getVoiceToKill(int max_voices);
@@ -433,6 +443,7 @@ namespace vital {
       void writeNonaccumulatedOutputs(poly_mask voice_mask, int num_samples);
 
       int polyphony_;
+      int max_polyphony_;
       bool legato_;
       std::map<Output*, std::unique_ptr<Output>> last_voice_outputs_;
       CircularQueue<std::pair<Output*, Output*>> nonaccumulated_outputs_;
@@ -474,12 +485,14 @@ namespace vital {
       VoiceOverride voice_override_;
 
       int total_notes_;
+      bool seeded_;
+      int seed_;
       CircularQueue<int> pressed_notes_;
-      CircularQueue<std::unique_ptr<Voice>> all_voices_;
+      std::vector<std::unique_ptr<Voice>> all_voices_;
 
       CircularQueue<Voice*> free_voices_;
       CircularQueue<Voice*> active_voices_;
-      CircularQueue<std::unique_ptr<AggregateVoice>> all_aggregate_voices_;
+      std::vector<std::unique_ptr<AggregateVoice>> all_aggregate_voices_;
       CircularQueue<AggregateVoice*> active_aggregate_voices_;
 
       ProcessorRouter voice_router_;
@@ -146,8 +146,14 @@ namespace vital {
         matrix interpolation_matrix = utils::getCatmullInterpolationMatrix(t);
 
         poly_int indices = (poly_int(offset_) - past_index - 2) & poly_int(bitmask_);
+      #if VITAL_AVX2
+        matrix value_matrix(utils::toPolyFloatFromUnaligned(buffers_[0] + indices[0], buffers_[0] + indices[4]),
+                            utils::toPolyFloatFromUnaligned(buffers_[1] + indices[1], buffers_[1] + indices[5]),
+                            0.0f, 0.0f);
+      #else
         matrix value_matrix(utils::toPolyFloatFromUnaligned(buffers_[0] + indices[0]),
                             utils::toPolyFloatFromUnaligned(buffers_[1] + indices[1]), 0.0f, 0.0f);
+      #endif
         value_matrix.transpose();
         return interpolation_matrix.multiplyAndSumRows(value_matrix);
       }
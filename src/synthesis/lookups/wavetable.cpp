@@ -48,12 +48,8 @@ namespace vital {
       old_num_frames = data_->num_frames;
     }
 
-    std::unique_ptr<WavetableData> old_data = std::move(data_);
-    data_ = std::make_unique<WavetableData>(num_frames, old_version + 1);
-    data_->wave_data = std::make_unique<mono_float[][kWaveformSize]>(num_frames);
-    data_->frequency_amplitudes = std::make_unique<poly_float[][kPolyFrequencySize]>(num_frames);
-    data_->normalized_frequencies = std::make_unique<poly_float[][kPolyFrequencySize]>(num_frames);
-    data_->phases = std::make_unique<poly_float[][kPolyFrequencySize]>(num_frames);
+    std::shared_ptr<WavetableData> old_data = std::move(data_);
+    data_ = createData(num_frames, old_version + 1);
 
     int frame_size = kWaveformSize * sizeof(mono_float);
     int frequency_size = kPolyFrequencySize * sizeof(poly_float);
@@ -87,11 +83,74 @@ namespace vital {
       std::this_thread::yield(); // Wait for audio thread to finish using old_data.
   }
 
+  std::unique_ptr<Wavetable::WavetableData> Wavetable::copyData() const {
+    int num_frames = current_data_->num_frames;
+    std::unique_ptr<WavetableData> data = createData(num_frames, current_data_->version);
+    data->frequency_ratio = current_data_->frequency_ratio;
+    data->sample_rate = current_data_->sample_rate;
+
+    int frequency_size = num_frames * kPolyFrequencySize * sizeof(poly_float);
+    memcpy(data->wave_data.get(), current_data_->wave_data.get(), num_frames * kWaveformSize * sizeof(mono_float));
+    memcpy(data->frequency_amplitudes.get(), current_data_->frequency_amplitudes.get(), frequency_size);
+    memcpy(data->normalized_frequencies.get(), current_data_->normalized_frequencies.get(), frequency_size);
+    memcpy(data->phases.get(), current_data_->phases.get(), frequency_size);
+    return data;
+  }
+
+  void Wavetable::loadData(const WavetableData* data) {
+    int num_frames = data->num_frames;
+    setNumFrames(num_frames);
+    makeDataUnique();
+    current_data_->frequency_ratio = data->frequency_ratio;
+    current_data_->sample_rate = data->sample_rate;
+
+    int frequency_size = num_frames * kPolyFrequencySize * sizeof(poly_float);
+    memcpy(current_data_->wave_data.get(), data->wave_data.get(), num_frames * kWaveformSize * sizeof(mono_float));
+    memcpy(current_data_->frequency_amplitudes.get(), data->frequency_amplitudes.get(), frequency_size);
+    memcpy(current_data_->normalized_frequencies.get(), data->normalized_frequencies.get(), frequency_size);
+    memcpy(current_data_->phases.get(), data->phases.get(), frequency_size);
+  }
+
+  void Wavetable::loadSharedData(std::shared_ptr<const WavetableData> data) {
+    VITAL_ASSERT(data->num_frames <= max_frames_);
+    if (data == data_)
+      return;
+
+    // Shared tables are never written in place. makeDataUnique() copies them before any change.
+    std::shared_ptr<WavetableData> old_data = std::move(data_);
+    data_ = std::const_pointer_cast<WavetableData>(std::move(data));
+    current_data_ = data_.get();
+    while (active_audio_data_.load())
+      std::this_thread::yield(); // Wait for audio thread to finish using old_data.
+  }
+
+  void Wavetable::makeDataUnique() {
+    if (data_.use_count() <= 1)
+      return;
+
+    std::shared_ptr<WavetableData> shared_data = std::move(data_);
+    data_ = copyData();
+    current_data_ = data_.get();
+    while (active_audio_data_.load())
+      std::this_thread::yield(); // Wait for audio thread to finish using shared_data.
+  }
+
+  std::unique_ptr<Wavetable::WavetableData> Wavetable::createData(int num_frames, int version) {
+    std::unique_ptr<WavetableData> data = std::make_unique<WavetableData>(num_frames, version);
+    data->wave_data = std::make_unique<mono_float[][kWaveformSize]>(num_frames);
+    data->frequency_amplitudes = std::make_unique<poly_float[][kPolyFrequencySize]>(num_frames);
+    data->normalized_frequencies = std::make_unique<poly_float[][kPolyFrequencySize]>(num_frames);
+    data->phases = std::make_unique<poly_float[][kPolyFrequencySize]>(num_frames);
+    return data;
+  }
+
   void Wavetable::setFrequencyRatio(float frequency_ratio) {
+    makeDataUnique();
     current_data_->frequency_ratio = frequency_ratio;
   }
 
   void Wavetable::setSampleRate(float rate) {
+    makeDataUnique();
     current_data_->sample_rate = rate;
   }
 
@@ -103,6 +162,7 @@ namespace vital {
     if (to_index >= current_data_->num_frames)
       return;
 
+    makeDataUnique();
     loadFrequencyAmplitudes(wave_frame->frequency_domain, to_index);
     loadNormalizedFrequencies(wave_frame->frequency_domain, to_index);
     memcpy(current_data_->wave_data[to_index], wave_frame->time_domain, kWaveformSize * sizeof(mono_float));
@@ -111,6 +171,7 @@ namespace vital {
   void Wavetable::postProcess(float max_span) {
     static constexpr float kMinAmplitudePhase = 0.1f;
 
+    makeDataUnique();
     if (max_span > 0.0f) {
       float scale = 2.0f / max_span;
       for (int w = 0; w < current_data_->num_frames; ++w) {
@@ -121,6 +121,15 @@ namespace vital {
         return active_audio_data_.load()->version;
       }
 
+      // Deep copy of the current tables, and the reverse, so rendered tables can be reused.
+      std::unique_ptr<WavetableData> copyData() const;
+      void loadData(const WavetableData* data);
+
+      // Hands out the current tables without copying them. Tables can be shared by any number of
+      // wavetables, and whichever one changes them next first takes a private copy.
+      std::shared_ptr<const WavetableData> shareData() const { return data_; }
+      void loadSharedData(std::shared_ptr<const WavetableData> data);
+
       void loadWaveFrame(const WaveFrame* wave_frame);
       void loadWaveFrame(const WaveFrame* wave_frame, int to_index);
       void postProcess(float max_span);
@@ -132,10 +141,13 @@ namespace vital {
       force_inline void markUnused() { active_audio_data_ = nullptr; }
 
       force_inline void setShepardTable(bool shepard) { shepard_table_ = shepard; }
-      force_inline bool isShepardTable() { return shepard_table_; }
+      force_inline bool isShepardTable() const { return shepard_table_; }
 
     protected:
       Wavetable() = default;
+
+      static std::unique_ptr<WavetableData> createData(int num_frames, int version);
+      void makeDataUnique();
     
       void loadFrequencyAmplitudes(const std::complex<float>* frequencies, int to_index);
       void loadNormalizedFrequencies(const std::complex<float>* frequencies, int to_index);
@@ -147,7 +159,7 @@ namespace vital {
       int max_frames_;
       WavetableData* current_data_;
       std::atomic<WavetableData*> active_audio_data_;
-      std::unique_ptr<WavetableData> data_;
+      std::shared_ptr<WavetableData> data_;
       bool shepard_table_;
 
       mono_float fft_data_[2 * kWaveformSize];
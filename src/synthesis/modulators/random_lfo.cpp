@@ -41,6 +41,13 @@ namespace vital {
     *sync_seconds_ = 0;
   }
 
+  void RandomLfo::setRandomSeed(int seed) {
+    state_ = RandomState();
+    *shared_state_ = RandomState();
+    last_value_ = 0.0f;
+    random_generator_.seed(seed);
+  }
+
   void RandomLfo::doReset(RandomState* state, bool mono, poly_float frequency) {
     poly_mask reset_mask = getResetMask(kReset);
     if (reset_mask.anyMask() == 0 || input(kSync)->at(0)[0])
@@ -113,13 +120,10 @@ namespace vital {
 
         poly_float* dest = output()->buffer;
         int update_samples = isControlRate() ? 1 : num_samples;
-        for (int i = 0; i < update_samples; ++i) {
-          poly_float value = dest[i] & constants::kFirstMask;
-          dest[i] = value + utils::swapVoices(value);
-        }
+        for (int i = 0; i < update_samples; ++i)
+          dest[i] = utils::broadcastFirstVoice(dest[i]);
 
-        poly_float trigger_value = output()->trigger_value & constants::kFirstMask;
-        output()->trigger_value = trigger_value + utils::swapVoices(trigger_value);
+        output()->trigger_value = utils::broadcastFirstVoice(output()->trigger_value);
         *last_sync_ = *sync_seconds_;
       }
     }
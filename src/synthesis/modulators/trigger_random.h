@@ -33,6 +33,10 @@ namespace vital {
 
       virtual Processor* clone() const override { return new TriggerRandom(*this); }
       virtual void process(int num_samples) override;
+      virtual void setRandomSeed(int seed) override {
+        value_ = 0.0f;
+        random_generator_.seed(seed);
+      }
 
     private:
       poly_float value_;
@@ -22,6 +22,7 @@ namespace vital {
 
   EnvelopeModule::EnvelopeModule(const std::string& prefix, bool force_audio_rate) :
       SynthModule(kNumInputs, kNumOutputs), prefix_(prefix), force_audio_rate_(force_audio_rate) {
+    setName(prefix_);
     envelope_ = new Envelope();
     envelope_->useInput(input(kTrigger), Envelope::kTrigger);
     
@@ -35,6 +35,7 @@ namespace vital {
       Processor* clone() const override { return new EqualizerModule(*this); }
 
       const StereoMemory* getAudioMemory() { return audio_memory_.get(); }
+      void setWriteAudioMemory(bool write) { write_audio_memory_ = write; }
 
     protected:
       Value* low_mode_;
@@ -49,6 +50,7 @@ namespace vital {
       DigitalSvf* high_shelf_;
 
       std::shared_ptr<StereoMemory> audio_memory_;
+      bool write_audio_memory_;
 
       JUCE_LEAK_DETECTOR(EqualizerModule) 
   };
@@ -35,6 +35,7 @@ namespace vital {
       comb_filter_(nullptr), digital_svf_(nullptr), dirty_filter_(nullptr),
       formant_filter_(nullptr), ladder_filter_(nullptr), phaser_filter_(nullptr),
       sallen_key_filter_(nullptr) {
+    setName(prefix_);
     comb_filter_ = new CombModule();
     digital_svf_ = new DigitalSvf();
     diode_filter_ = new DiodeFilter();
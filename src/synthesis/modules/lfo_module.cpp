@@ -23,6 +23,7 @@ namespace vital {
 
   LfoModule::LfoModule(const std::string& prefix, LineGenerator* line_generator, const Output* beats_per_second) :
       SynthModule(kNumInputs, kNumOutputs), prefix_(prefix), beats_per_second_(beats_per_second) {
+    setName(prefix_);
     lfo_ = new SynthLfo(line_generator);
     addProcessor(lfo_);
 
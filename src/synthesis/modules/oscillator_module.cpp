@@ -25,6 +25,7 @@ namespace vital {
       SynthModule(kNumInputs, kNumOutputs), prefix_(std::move(prefix)), on_(nullptr), distortion_type_(nullptr) {
     wavetable_ = std::make_shared<Wavetable>(kNumOscillatorWaveFrames);
     was_on_ = std::make_shared<bool>(true);
+    setName(prefix_);
   }
 
   void OscillatorModule::init() {
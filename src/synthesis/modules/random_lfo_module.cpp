@@ -22,6 +22,7 @@ namespace vital {
 
   RandomLfoModule::RandomLfoModule(const std::string& prefix, const Output* beats_per_second) :
       SynthModule(kNumInputs, 1), prefix_(prefix), beats_per_second_(beats_per_second) {
+    setName(prefix_);
     lfo_ = new RandomLfo();
     addProcessor(lfo_);
   }
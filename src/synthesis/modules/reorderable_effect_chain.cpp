@@ -65,11 +65,13 @@ namespace vital {
 
   ReorderableEffectChain::ReorderableEffectChain(const Output* beats_per_second, const Output* keytrack) :
       vital::SynthModule(kNumInputs, 1), equalizer_memory_(nullptr),
-      beats_per_second_(beats_per_second), keytrack_(keytrack), last_order_(0.0f) {
+      beats_per_second_(beats_per_second), keytrack_source_(keytrack), keytrack_(std::make_shared<cr::Output>()),
+      last_order_(0.0f) {
     for (int i = 0; i < constants::kNumEffects; ++i) {
       SynthModule* effect_module = createEffectModule(i);
       VITAL_ASSERT(effect_module);
 
+      effect_module->setName(strings::kEffectOrder[i]);
       addSubmodule(effect_module);
       addProcessor(effect_module);
       effects_on_[i] = createBaseControl(strings::kEffectOrder[i] + "_on");
@@ -80,6 +82,10 @@ namespace vital {
     last_order_ = utils::encodeOrderToFloat(effect_order_, constants::kNumEffects);
   }
 
+  void ReorderableEffectChain::setWriteEqualizerMemory(bool write) {
+    static_cast<EqualizerModule*>(effects_[constants::kEq])->setWriteAudioMemory(write);
+  }
+
   SynthModule* ReorderableEffectChain::createEffectModule(int index) {
     switch(index) {
       case constants::kChorus:
@@ -98,7 +104,7 @@ namespace vital {
       case constants::kFlanger:
         return new FlangerModule(beats_per_second_);
       case constants::kFilterFx:
-        return new FilterFxModule(keytrack_);
+        return new FilterFxModule(keytrack_.get());
       case constants::kPhaser:
         return new PhaserModule(beats_per_second_);
       case constants::kReverb:
@@ -109,6 +115,7 @@ namespace vital {
   }
 
   void ReorderableEffectChain::process(int num_samples) {
+    setKeytrack(keytrack_source_->buffer[0]);
     const poly_float* audio_in = input(kAudio)->source->buffer;
     processWithInput(audio_in, num_samples);
   }
@@ -43,13 +43,18 @@ namespace vital {
 
       SynthModule* getEffect(constants::Effect effect) { return effects_[effect]; }
       const StereoMemory* getEqualizerMemory() { return equalizer_memory_; }
+      void setWriteEqualizerMemory(bool write);
+      // process() copies the keytrack in from its source. Callers of processWithInput set it here instead.
+      void setKeytrack(poly_float keytrack) { keytrack_->buffer[0] = keytrack; }
 
     protected:
       SynthModule* createEffectModule(int index);
 
       const StereoMemory* equalizer_memory_;
       const Output* beats_per_second_;
-      const Output* keytrack_;
+      const Output* keytrack_source_;
+      // The filter effect reads this copy so the voices can move on to the next block while effects run.
+      std::shared_ptr<cr::Output> keytrack_;
       SynthModule* effects_[constants::kNumEffects];
       Value* effects_on_[constants::kNumEffects];
       int effect_order_[constants::kNumEffects];
@@ -23,6 +23,7 @@ namespace vital {
   SampleModule::SampleModule() : SynthModule(kNumInputs, kNumOutputs), on_(nullptr) {
     sampler_ = new SampleSource();
     was_on_ = std::make_shared<bool>(true);
+    setName("sample");
   }
 
   void SampleModule::init() {
@@ -38,7 +38,8 @@ namespace vital {
       pitch_wheel_(nullptr), filters_module_(nullptr), lfos_(), envelopes_(), lfo_sources_(), random_(nullptr),
       random_lfos_(), note_mapping_(nullptr), velocity_mapping_(nullptr), aftertouch_mapping_(nullptr),
       slide_mapping_(nullptr), lift_mapping_(nullptr), mod_wheel_mapping_(nullptr),
-      pitch_wheel_mapping_(nullptr), stereo_(nullptr), note_percentage_(nullptr), last_active_voice_mask_(0) {
+      pitch_wheel_mapping_(nullptr), stereo_(nullptr), note_percentage_(nullptr), last_active_voice_mask_(0),
+      update_status_outputs_(true) {
     output_ = new Multiply();
     registerOutput(output_->output());
 
@@ -315,25 +316,25 @@ namespace vital {
     note_retriggered_.clearTrigger();
 
     if (num_voices == 0) {
-      for (auto& status_source : data_->status_outputs)
-        status_source.second->clear();
+      if (update_status_outputs_) {
+        for (auto& status_source : data_->status_outputs)
+          status_source.second->clear();
+      }
     }
     else {
       last_active_voice_mask_ = getCurrentVoiceMask();
-      for (auto& status_source : data_->status_outputs)
-        status_source.second->update(last_active_voice_mask_);
+      if (update_status_outputs_) {
+        for (auto& status_source : data_->status_outputs)
+          status_source.second->update(last_active_voice_mask_);
+      }
 
       for (ModulationConnectionProcessor* processor : enabled_modulation_processors_) {
         poly_float* buffer = processor->output()->buffer;
-        if (processor->isControlRate() || processor->isPolyphonicModulation()) {
-          poly_float masked_value = buffer[0] & last_active_voice_mask_;
-          buffer[0] = masked_value + utils::swapVoices(masked_value);
-        }
+        if (processor->isControlRate() || processor->isPolyphonicModulation())
+          buffer[0] = utils::sumVoices(buffer[0] & last_active_voice_mask_);
         else {
-          for (int i = 0; i < num_samples; ++i) {
-            poly_float masked_value = buffer[i] & last_active_voice_mask_;
-            buffer[i] = masked_value + utils::swapVoices(masked_value);
-          }
+          for (int i = 0; i < num_samples; ++i)
+            buffer[i] = utils::sumVoices(buffer[i] & last_active_voice_mask_);
         }
       }
     }
@@ -70,6 +70,9 @@ namespace vital {
         return enabled_modulation_processors_;
       }
 
+      // Status outputs only feed the interface so headless renders can turn them off.
+      void setUpdateStatusOutputs(bool update) { update_status_outputs_ = update; }
+
     private:
       void createNoteArticulation();
       void createProducers();
@@ -121,6 +124,7 @@ namespace vital {
 
       output_map poly_readouts_;
       poly_mask last_active_voice_mask_;
+      bool update_status_outputs_;
 
       JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SynthVoiceHandler)
   };
@@ -15,6 +15,7 @@
  */
 
 #include "sample_source.h"
+#include "audio_block.h"
 #include "futils.h"
 #include "synth_constants.h"
 
@@ -273,8 +274,8 @@ namespace vital {
     VITAL_ASSERT(active_audio_data_.is_lock_free());
 
     size = std::min(size, kMaxSize);
-    std::unique_ptr<SampleData> old_data = std::move(data_);
-    data_ = std::make_unique<SampleData>(size, sample_rate, false);
+    std::shared_ptr<SampleData> old_data = std::move(data_);
+    data_ = std::make_shared<SampleData>(size, sample_rate, false);
     createBandLimitedBuffers(data_->left_buffers, data_->left_loop_buffers, buffer, size);
 
     current_data_ = data_.get();
@@ -283,8 +284,8 @@ namespace vital {
   }
 
   void Sample::loadSample(const mono_float* left_buffer, const mono_float* right_buffer, int size, int sample_rate) {
-    std::unique_ptr<SampleData> old_data = std::move(data_);
-    data_ = std::make_unique<SampleData>(size, sample_rate, true);
+    std::shared_ptr<SampleData> old_data = std::move(data_);
+    data_ = std::make_shared<SampleData>(size, sample_rate, true);
     createBandLimitedBuffers(data_->left_buffers, data_->left_loop_buffers, left_buffer, size);
     createBandLimitedBuffers(data_->right_buffers, data_->right_loop_buffers, right_buffer, size);
 
@@ -294,14 +295,27 @@ namespace vital {
   }
 
   void Sample::init() {
-    name_ = kDefaultName;
-    mono_float buffer[kDefaultSampleLength];
-    utils::RandomGenerator random_generator(-0.9f, 0.9f);
+    // Band limiting the default noise is slow, so it's built once and shared by every Sample.
+    static const std::shared_ptr<SampleData> default_data = [] {
+      mono_float buffer[kDefaultSampleLength];
+      utils::RandomGenerator random_generator(-0.9f, 0.9f);
+      random_generator.seed(kDefaultNoiseSeed);
+
+      for (int i = 0; i < kDefaultSampleLength; ++i)
+        buffer[i] = random_generator.next();
 
-    for (int i = 0; i < kDefaultSampleLength; ++i)
-      buffer[i] = random_generator.next();
+      std::shared_ptr<SampleData> data = std::make_shared<SampleData>(kDefaultSampleLength, kDefaultSampleRate, false);
+      createBandLimitedBuffers(data->left_buffers, data->left_loop_buffers, buffer, kDefaultSampleLength);
+      return data;
+    }();
+
+    name_ = kDefaultName;
+    std::shared_ptr<SampleData> old_data = std::move(data_);
+    data_ = default_data;
 
-    loadSample(buffer, kDefaultSampleLength, kDefaultSampleRate);
+    current_data_ = data_.get();
+    while (active_audio_data_.load())
+      std::this_thread::yield(); // Wait for audio thread to finish using old_data.
   }
 
   json Sample::stateToJson() {
@@ -339,20 +353,14 @@ namespace vital {
     int length = data["length"];
     int sample_rate = data["sample_rate"];
 
-    MemoryOutputStream decoded(length * sizeof(int16_t));
-    std::string wave_data = data["samples"];
-    Base64::convertFromBase64(decoded, wave_data);
     std::unique_ptr<int16_t[]> pcm_data = std::make_unique<int16_t[]>(length);
-    memcpy(pcm_data.get(), decoded.getData(), length * sizeof(int16_t));
+    audio_block::copy(data["samples"], pcm_data.get(), length * sizeof(int16_t));
     std::unique_ptr<mono_float[]> buffer = std::make_unique<mono_float[]>(length);
     utils::pcmToFloatData(buffer.get(), pcm_data.get(), length);
 
     if (data.count("samples_stereo")) {
-      MemoryOutputStream decoded_stereo(length * sizeof(int16_t));
-      std::string wave_data_stereo = data["samples_stereo"];
-      Base64::convertFromBase64(decoded_stereo, wave_data_stereo);
       std::unique_ptr<int16_t[]> pcm_data_stereo = std::make_unique<int16_t[]>(length);
-      memcpy(pcm_data_stereo.get(), decoded_stereo.getData(), length * sizeof(int16_t));
+      audio_block::copy(data["samples_stereo"], pcm_data_stereo.get(), length * sizeof(int16_t));
 
       std::unique_ptr<mono_float[]> buffer_stereo = std::make_unique<mono_float[]>(length);
       utils::pcmToFloatData(buffer_stereo.get(), pcm_data_stereo.get(), length);
@@ -402,9 +410,7 @@ namespace vital {
     
     poly_float reset_value = -reset_offset;
     if (input(kRandomPhase)->at(0)[0]) {
-      reset_value = random_generator_.next() * audio_length;
-      reset_value = utils::maskLoad(reset_value, random_generator_.next() * audio_length, constants::kFirstMask);
-      reset_value -= reset_offset;
+      reset_value = random_generator_.polyVoiceNext() * audio_length - reset_offset;
     }
     
     sample_index_ = utils::maskLoad(sample_index_, utils::floor(reset_value), reset_mask);
@@ -27,6 +27,7 @@ namespace vital {
   class Sample {
     public:
       static constexpr int kDefaultSampleLength = 44100;
+      static constexpr int kDefaultNoiseSeed = 0x5;
       static constexpr int kUpsampleTimes = 1;
       static constexpr int kBufferSamples = 4;
       static constexpr int kMinSize = 4;
@@ -108,7 +109,8 @@ namespace vital {
       std::string last_browsed_file_;
       SampleData* current_data_;
       std::atomic<SampleData*> active_audio_data_;
-      std::unique_ptr<SampleData> data_;
+      // Shared so every Sample can point at the same default noise. Never modified once loaded.
+      std::shared_ptr<SampleData> data_;
 
       JUCE_LEAK_DETECTOR(Sample)
   };
@@ -148,6 +150,7 @@ namespace vital {
 
       virtual void process(int num_samples) override;
       virtual Processor* clone() const override { return new SampleSource(*this); }
+      virtual void setRandomSeed(int seed) override { random_generator_.seed(seed); }
       Sample* getSample() { return sample_.get(); }
       force_inline Output* getPhaseOutput() const { return phase_output_.get(); }
 
@@ -31,6 +31,24 @@ namespace vital {
   static constexpr mono_float kPhaseDisperseScale = 0.05f;
   static constexpr mono_float kSkewScale = 16.0f;
   static constexpr int kMaxPolyIndex = WaveFrame::kWaveformSize / poly_float::kSize;
+  static constexpr int kBinPairSize = 4;
+
+  // Each stereo pair of lanes holds one frequency bin. Returns the bin offset of every lane in a vector.
+  static force_inline poly_float getBinOffsets() {
+    poly_float result;
+    for (int i = 0; i < poly_float::kSize; ++i)
+      result.set(i, i / 2);
+    return result;
+  }
+
+  // Morphs that write whole vectors keep harmonics in pairs of bins up to last_harmonic. Clears the bins a wider
+  // vector wrote past that pair so every backend keeps the same harmonics.
+  static force_inline void clearPastLastBinPair(poly_float* wave_start, int last_harmonic) {
+    int last_index = 2 * last_harmonic / poly_float::kSize;
+    mono_float* start = (mono_float*)wave_start;
+    for (int i = kBinPairSize * (last_harmonic / 2 + 1); i < (last_index + 1) * poly_float::kSize; ++i)
+      start[i] = 0.0f;
+  }
 
   static force_inline void transformAndWrapBuffer(FourierTransform* transform, mono_float* buffer) {
     transform->transformRealInverse(buffer + poly_float::kSize);
@@ -65,6 +83,7 @@ namespace vital {
     for (int i = last_index + 1; i < kMaxPolyIndex; ++i)
       wave_start[i] = 0.0f;
 
+    clearPastLastBinPair(wave_start, last_harmonic);
     transformAndWrapBuffer(transform, dest);
   }
 
@@ -88,6 +107,8 @@ namespace vital {
     for (int i = last_index + 1; i < kMaxPolyIndex; ++i)
       poly_wave_start[i] = 0.0f;
 
+    clearPastLastBinPair(poly_wave_start, last_harmonic);
+
     const mono_float* frequency_amplitudes = (const mono_float*)wavetable_data->frequency_amplitudes[wavetable_index];
     const mono_float* normalized = (const mono_float*)wavetable_data->normalized_frequencies[wavetable_index];
     const mono_float* phases = (const mono_float*)wavetable_data->phases[wavetable_index];
@@ -189,13 +210,13 @@ namespace vital {
     int last_index = 2 * last_harmonic / poly_float::kSize;
 
     float offset = -(kCenterMorph - 1.0f) * (kCenterMorph - 1.0f) * phase_shift;
-    poly_float value_offset(0.0f, 0.0f, 1.0f, 1.0f);
+    poly_float value_offset = getBinOffsets();
     poly_float phase_offset(0.25f, 0.0f, 0.25f, 0.0f);
     poly_float scale = 0.5f / kPi;
     for (int i = 0; i <= last_index; ++i) {
       poly_float amplitude = frequency_amplitudes[i];
       poly_float normalized = normalized_frequencies[i];
-      poly_float index = value_offset + 2.0f * i;
+      poly_float index = value_offset + (poly_float::kSize / 2.0f) * i;
 
       poly_float delta_center = (index - kCenterMorph) * (index - kCenterMorph) * phase_shift + offset;
       poly_float phase = utils::mod(delta_center * scale + phase_offset);
@@ -211,30 +232,37 @@ namespace vital {
     for (int i = last_index + 1; i < kMaxPolyIndex; ++i)
       wave_start[i] = 0.0f;
 
+    clearPastLastBinPair(wave_start, last_harmonic);
     transformAndWrapBuffer(transform, dest);
   }
 
   static void smearMorph(const Wavetable::WavetableData* wavetable_data,
                          int wavetable_index, poly_float* dest, FourierTransform* transform,
                          float smear, int last_harmonic, const poly_float* data_buffer) {
-    const poly_float* frequency_amplitudes = wavetable_data->frequency_amplitudes[wavetable_index];
-    const poly_float* normalized_frequencies = wavetable_data->normalized_frequencies[wavetable_index];
-
-    poly_float* wave_start = dest + 1;
-    int last_index = 2 * last_harmonic / poly_float::kSize;
+    const mono_float* amplitudes = (const mono_float*)wavetable_data->frequency_amplitudes[wavetable_index];
+    const mono_float* normalized = (const mono_float*)wavetable_data->normalized_frequencies[wavetable_index];
 
-    poly_float amplitude = frequency_amplitudes[0] * (1.0f - smear);
-    wave_start[0] = amplitude * normalized_frequencies[0];
+    // The smear runs from one pair of bins to the next no matter how many pairs fit in a vector.
+    mono_float* wave_start = (mono_float*)(dest + 1);
+    int last_pair = last_harmonic / 2;
 
-    for (int i = 1; i <= last_index; ++i) {
-      poly_float original_amplitude = frequency_amplitudes[i];
-      amplitude = utils::interpolate(original_amplitude, amplitude, smear);
+    mono_float amplitude[kBinPairSize];
+    for (int i = 0; i < kBinPairSize; ++i) {
+      amplitude[i] = amplitudes[i] * (1.0f - smear);
+      wave_start[i] = amplitude[i] * normalized[i];
+    }
 
-      wave_start[i] = amplitude * normalized_frequencies[i];
-      amplitude *= (i + 0.25f) / i;
+    for (int p = 1; p <= last_pair; ++p) {
+      float mult = (p + 0.25f) / p;
+      for (int i = 0; i < kBinPairSize; ++i) {
+        int index = p * kBinPairSize + i;
+        amplitude[i] = utils::interpolate(amplitudes[index], amplitude[i], smear);
+        wave_start[index] = amplitude[i] * normalized[index];
+        amplitude[i] *= mult;
+      }
     }
 
-    for (int i = last_index + 1; i < kMaxPolyIndex; ++i)
+    for (int i = (last_pair + 1) * kBinPairSize; i < WaveFrame::kWaveformSize; ++i)
       wave_start[i] = 0.0f;
 
     transformAndWrapBuffer(transform, dest);
@@ -259,14 +287,11 @@ namespace vital {
     for (int i = last_index + 1; i <= kMaxPolyIndex; ++i)
       wave_start[i] = 0.0f;
 
-    poly_float last_mult = 1.0f;
-    if (t >= 1.0f)
-      last_mult = poly_float(1.0f, 1.0f, t - 1.0f, t - 1.0f);
-    else
-      last_mult = poly_float(t, t, 0.0f, 0.0f);
+    poly_float last_mult = utils::clamp(poly_float(t) - getBinOffsets(), 0.0f, 1.0f);
 
     wave_start[last_index] = wave_start[last_index] * last_mult;
 
+    clearPastLastBinPair(wave_start, last_harmonic);
     transformAndWrapBuffer(transform, dest);
   }
 
@@ -293,14 +318,11 @@ namespace vital {
     for (int i = last_index + 1; i <= kMaxPolyIndex; ++i)
       wave_start[i] = 0.0f;
 
-    poly_float last_mult = 1.0f;
-    if (t >= 1.0f)
-      last_mult = poly_float(0.0f, 0.0f, 2.0f - t, 2.0f - t);
-    else
-      last_mult = poly_float(1.0f - t, 1.0f - t, 1.0f, 1.0f);
+    poly_float last_mult = utils::clamp(getBinOffsets() + 1.0f - t, 0.0f, 1.0f);
 
     wave_start[start_index] = wave_start[start_index] * last_mult;
 
+    clearPastLastBinPair(wave_start, last_harmonic);
     transformAndWrapBuffer(transform, dest);
   }
 
@@ -391,15 +413,13 @@ namespace vital {
                                    float mult, int last_harmonic, const poly_float* data_buffer) {
     poly_float* poly_data_start = dest + 2 + kMaxPolyIndex;
 
-    poly_float offset(0.0f, 2.0f, 1.0f, 3.0f);
-    for (int i = 0; i <= kMaxPolyIndex / 2; ++i) {
-      poly_float index = offset + i * 4;
+    poly_float offset = getBinOffsets();
+    for (int i = 0; i < kMaxPolyIndex + 2; ++i) {
+      poly_float index = offset + i * (poly_float::kSize / 2);
       poly_float octave = futils::log2(index);
       poly_float power = octave * (1.0f / (Wavetable::kFrequencyBins - 1.0f));
       poly_float shift = futils::pow(mult, power);
-      poly_float shifted_index = utils::max(1.0f, shift * (index - 1.0f) + 1.0f);
-      poly_data_start[2 * i] = shifted_index;
-      poly_data_start[2 * i + 1] = utils::swapStereo(shifted_index);
+      poly_data_start[i] = utils::max(1.0f, shift * (index - 1.0f) + 1.0f);
     }
 
     const mono_float* amplitudes = (const mono_float*)wavetable_data->frequency_amplitudes[wavetable_index];
@@ -455,14 +475,17 @@ namespace vital {
     poly_float center = poly_float(1.0f) - scale;
     poly_float mult = 1.0f + shift;
 
-    const poly_float* buffer1 = data_buffer + index * kNumHarmonics / poly_float::kSize;
-    const poly_float* buffer2 = data_buffer + (index + 1) * kNumHarmonics / poly_float::kSize;
+    // Stages start on a pair of bins so every backend reads the same random values.
+    const mono_float* random_values = (const mono_float*)data_buffer;
+    const mono_float* buffer1 = random_values + kBinPairSize * (index * kNumHarmonics / kBinPairSize);
+    const mono_float* buffer2 = random_values + kBinPairSize * ((index + 1) * kNumHarmonics / kBinPairSize);
 
     poly_float random_t(amount, 1.0f - amount, amount, 1.0f - amount);
     for (int i = 0; i <= last_index; ++i) {
-      poly_float random_value1 = buffer1[i] & constants::kLeftMask;
+      int offset = i * poly_float::kSize;
+      poly_float random_value1 = utils::toPolyFloatFromUnaligned(buffer1 + offset) & constants::kLeftMask;
       random_value1 = random_value1 + utils::swapStereo(random_value1);
-      poly_float random_value2 = buffer2[i] & constants::kLeftMask;
+      poly_float random_value2 = utils::toPolyFloatFromUnaligned(buffer2 + offset) & constants::kLeftMask;
       random_value2 = random_value2 + utils::swapStereo(random_value2);
       poly_float random1 = mult * utils::max(center - scale * random_value1, 0.0f);
       poly_float random2 = mult * utils::max(center - scale * random_value2, 0.0f);
@@ -473,6 +496,7 @@ namespace vital {
     for (int i = last_index + 1; i <= kMaxPolyIndex; ++i)
       wave_start[i] = 0.0f;
 
+    clearPastLastBinPair(wave_start, last_harmonic);
     transformAndWrapBuffer(transform, dest);
   }
 } // namespace vital
@@ -463,6 +463,12 @@ namespace vital {
           current_detuned_amplitude, delta_detuned_amplitude);
     }
 
+    // A lone active voice packs its oscillators into the idle voice's lanes. That only works with two voices
+    // per vector so wider backends process every voice instead.
+    force_inline bool isSingleVoice(poly_mask active_mask) {
+      return kNumVoicesPerProcess == 2 && (~active_mask).anyMask();
+    }
+
     template<class T>
     force_inline T compactAndLoadVoice(T* values, poly_mask active_mask) {
       T one = values[0];
@@ -923,8 +929,7 @@ namespace vital {
   }
 
   force_inline void SynthOscillator::loadVoiceBlock(VoiceBlock& voice_block, int index, poly_mask active_mask) {
-    bool single_voice = (~active_mask).anyMask();
-    if (single_voice) {
+    if (isSingleVoice(active_mask)) {
       voice_block.phase = compactAndLoadVoice(phases_ + 2 * index, active_mask);
       voice_block.phase_inc_mult = compactAndLoadVoice(phase_inc_mults_ + 2 * index, active_mask);
       voice_block.from_phase_inc_mult = compactAndLoadVoice(from_phase_inc_mults_ + 2 * index, active_mask);
@@ -1209,8 +1214,8 @@ namespace vital {
     }
 
     poly_float active_voice = input(kActiveVoices)->at(0);
+    bool single_voice = isSingleVoice(poly_float::equal(active_voice, 1.0f));
     bool left_active = active_voice[0] == 1.0f;
-    bool right_active = active_voice[2] == 1.0f;
 
     unison_ = utils::clamp(roundf(input(kUnisonVoices)->at(0)[0]), 1.0f, kMaxUnison);
     setActiveOscillators(unison_ + (unison_ % 2));
@@ -1251,7 +1256,7 @@ namespace vital {
         else
           voice_block_.modulation_buffer = first_mod_oscillator_->buffer;
         
-        if (left_active && right_active)
+        if (!single_voice)
           processOscillators<fmPhase, passThroughWindow>(num_samples, distortion_type);
         else if (left_active)
           processOscillators<fmPhaseLeft, passThroughWindow>(num_samples, distortion_type);
@@ -1268,7 +1273,7 @@ namespace vital {
         else
           voice_block_.modulation_buffer = first_mod_oscillator_->buffer;
 
-        if (left_active && right_active)
+        if (!single_voice)
           processOscillators<passThroughPhase, rmWindow>(num_samples, distortion_type);
         else if (left_active)
           processOscillators<passThroughPhase, rmWindowLeft>(num_samples, distortion_type);
@@ -1380,10 +1385,10 @@ namespace vital {
 
     poly_mask wave_buffer_mask = reset_mask | retrigger_mask;
     poly_float buffer_phase_inc = phase_inc_buffer_->buffer[num_samples - 1] * (1.0f / kPhaseMult);
-    if (wave_buffer_mask[0])
-      setWaveBuffers(buffer_phase_inc, 0);
-    if (wave_buffer_mask[2])
-      setWaveBuffers(buffer_phase_inc, 2);
+    for (int v = 0; v < kNumVoicesPerProcess; ++v) {
+      if (wave_buffer_mask[2 * v])
+        setWaveBuffers(buffer_phase_inc, 2 * v);
+    }
 
     if (reset_mask.anyMask())
       reset(reset_mask, trigger_offset);
@@ -1410,7 +1415,9 @@ namespace vital {
     voice_block_.current_buffer_sample &= active_voice_mask;
     while (voice_block_.start_sample < num_samples) {
       poly_int remaining_fade_samples = poly_int(voice_block_.num_buffer_samples) - voice_block_.current_buffer_sample;
-      int min_remaining_fade_samples = std::min(remaining_fade_samples[0], remaining_fade_samples[2]);
+      int min_remaining_fade_samples = remaining_fade_samples[0];
+      for (int v = 1; v < kNumVoicesPerProcess; ++v)
+        min_remaining_fade_samples = std::min<int>(min_remaining_fade_samples, remaining_fade_samples[2 * v]);
       int samples = std::min(min_remaining_fade_samples, num_samples - voice_block_.start_sample);
       voice_block_.end_sample = voice_block_.start_sample + samples;
       processChunk<phaseDistort, window>(current_center_amplitude, current_detuned_amplitude);
@@ -1422,13 +1429,11 @@ namespace vital {
       if (shepard && new_buffer_mask.anyMask())
         doShepardWrap(new_buffer_mask, transpose_quantize_);
 
-      if (new_buffer_mask[0])
-        setWaveBuffers(buffer_phase_inc, 0);
-      if (new_buffer_mask[2])
-        setWaveBuffers(buffer_phase_inc, 2);
-
-      VITAL_ASSERT((int)voice_block_.current_buffer_sample[0] < voice_block_.num_buffer_samples);
-      VITAL_ASSERT((int)voice_block_.current_buffer_sample[2] < voice_block_.num_buffer_samples);
+      for (int v = 0; v < kNumVoicesPerProcess; ++v) {
+        if (new_buffer_mask[2 * v])
+          setWaveBuffers(buffer_phase_inc, 2 * v);
+        VITAL_ASSERT((int)voice_block_.current_buffer_sample[2 * v] < voice_block_.num_buffer_samples);
+      }
     }
 
     if (reset_mask.anyMask())
@@ -1444,9 +1449,9 @@ namespace vital {
     if (active_channels < 2)
       return;
 
-    VITAL_ASSERT(active_channels == 2 || active_channels == 4);
-    int num_active_voices = active_channels / 2;
+    VITAL_ASSERT(active_channels % 2 == 0);
     poly_mask active_voice_mask = poly_float::equal(input(kActiveVoices)->at(0), 1.0f);
+    bool single_voice = isSingleVoice(active_voice_mask);
     int num_samples = voice_block_.end_sample - voice_block_.start_sample;
 
     poly_float* audio_out = output(kRaw)->buffer + voice_block_.start_sample;
@@ -1455,7 +1460,7 @@ namespace vital {
     poly_float center_amplitude = center_amplitude_;
     poly_float detuned_amplitude = detuned_amplitude_;
 
-    if (num_active_voices < 2) {
+    if (single_voice) {
       poly_float current_detuned_swap = utils::swapVoices(current_detuned_amplitude);
       current_detuned_amplitude = utils::maskLoad(current_detuned_swap, current_detuned_amplitude, active_voice_mask);
       current_center_amplitude = utils::maskLoad(current_detuned_amplitude,
@@ -1476,12 +1481,14 @@ namespace vital {
                                                            active_voice_mask);
     }
 
-    int num_phase_updates = (poly_float::kSize - 1 + num_active_voices * active_oscillators_) / poly_float::kSize;
+    int num_phase_updates = active_oscillators_ / 2;
+    if (single_voice)
+      num_phase_updates = (poly_float::kSize - 1 + active_oscillators_) / poly_float::kSize;
     for (int p = 1; p < num_phase_updates; ++p) {
       loadVoiceBlock(voice_block_, p, active_voice_mask);
 
       poly_int phase = processDetuned<phaseDistort, window>(voice_block_, audio_out);
-      if (num_active_voices < 2)
+      if (single_voice)
         expandAndWriteVoice(phases_ + 2 * p, phase, active_voice_mask);
       else
         phases_[p] = phase;
@@ -1498,7 +1505,7 @@ namespace vital {
                                                                 current_center_amplitude, delta_center_amplitude,
                                                                 current_detuned_amplitude, delta_detuned_amplitude);
 
-    if (num_active_voices < 2) {
+    if (single_voice) {
       expandAndWriteVoice(phases_, center_phase, active_voice_mask);
       convertVoiceChannels(num_samples, audio_out, active_voice_mask);
     }
@@ -215,6 +215,7 @@ namespace vital {
       void setDistortionValues(DistortionType distortion_type);
       void process(int num_samples) override;
       Processor* clone() const override { return new SynthOscillator(*this); }
+      void setRandomSeed(int seed) override { random_generator_.seed(seed); }
 
       void setFirstOscillatorOutput(Output* oscillator) { first_mod_oscillator_ = oscillator; }
       void setSecondOscillatorOutput(Output* oscillator) { second_mod_oscillator_ = oscillator; }
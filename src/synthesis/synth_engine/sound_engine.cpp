@@ -32,7 +32,10 @@ namespace vital {
 
   SoundEngine::SoundEngine() : SynthModule(0, 1), voice_handler_(nullptr), effect_chain_(nullptr),
                                output_total_(nullptr), last_oversampling_amount_(-1), last_sample_rate_(-1),
-                               oversampling_(nullptr), legato_(nullptr), decimator_(nullptr), peak_meter_(nullptr) {
+                               oversampling_(nullptr), legato_(nullptr), decimator_(nullptr), peak_meter_(nullptr),
+                               lean_processing_(false), profiling_(false),
+                               profiler_(std::make_unique<ProcessorProfiler>()),
+                               effect_profiler_(std::make_unique<ProcessorProfiler>()) {
     SoundEngine::init();
     bps_ = data_->controls["beats_per_minute"];
     modulation_processors_.reserve(kMaxModulationConnections);
@@ -61,8 +64,8 @@ namespace vital {
     Value* voice_override = createBaseControl("voice_override");
 
     voice_handler_ = new SynthVoiceHandler(beats_per_second_clamped->output());
+    voice_handler_->setName("voices");
     addSubmodule(voice_handler_);
-    voice_handler_->setPolyphony(vital::kMaxPolyphony);
     voice_handler_->plug(polyphony, VoiceHandler::kPolyphony);
     voice_handler_->plug(voice_priority, VoiceHandler::kVoicePriority);
     voice_handler_->plug(voice_override, VoiceHandler::kVoiceOverride);
@@ -203,6 +206,172 @@ namespace vital {
     return voice_handler_->getNumActiveVoices();
   }
 
+  int SoundEngine::getNumAllocatedVoices() {
+    return voice_handler_->getNumAllocatedVoices();
+  }
+
+  int SoundEngine::trimVoices() {
+    return voice_handler_->trimVoices();
+  }
+
+  // Skips the meters, status outputs and equalizer memory that only the interface reads.
+  void SoundEngine::setLeanProcessing(bool lean) {
+    lean_processing_ = lean;
+    voice_handler_->setUpdateStatusOutputs(!lean);
+    effect_chain_->setWriteEqualizerMemory(!lean);
+    peak_meter_->enable(!lean);
+  }
+
+  void SoundEngine::setProfiling(bool profiling) {
+    if (profiling && !profiling_)
+      resetProfile();
+    profiling_ = profiling;
+  }
+
+  void SoundEngine::resetProfile() {
+    profiler_->reset();
+    effect_profiler_->reset();
+  }
+
+  std::vector<ProcessorProfiler::Report> SoundEngine::getProfile() const {
+    std::vector<ProcessorProfiler::Report> reports;
+    profiler_->report(reports);
+    effect_profiler_->report(reports);
+
+    std::map<std::string, ProcessorProfiler::Report> merged;
+    for (const ProcessorProfiler::Report& report : reports) {
+      auto found = merged.find(report.name);
+      if (found == merged.end())
+        merged[report.name] = report;
+      else {
+        found->second.cycles += report.cycles;
+        found->second.calls += report.calls;
+        found->second.seconds += report.seconds;
+      }
+    }
+
+    reports.clear();
+    for (auto& report : merged)
+      reports.push_back(report.second);
+    std::sort(reports.begin(), reports.end(), [](const ProcessorProfiler::Report& one,
+                                                 const ProcessorProfiler::Report& two) {
+      return one.cycles > two.cycles;
+    });
+    return reports;
+  }
+
+  bool SoundEngine::canPipeline(const std::vector<std::string>& changing_controls) {
+    if (shouldUpdate())
+      updateAllProcessors();
+
+    if (!local_feedback_order_.empty() || getVoiceHandlerIndex() < 0)
+      return false;
+
+    control_map voice_controls = voice_handler_->getControls();
+    input_map& voice_destinations = voice_handler_->getMonoModulationDestinations();
+    for (const std::string& name : changing_controls) {
+      if (voice_controls.count(name) == 0 && voice_destinations.count(name) == 0)
+        return false;
+    }
+    return true;
+  }
+
+  int SoundEngine::getVoiceHandlerIndex() {
+    for (int i = 0; i < local_order_.size(); ++i) {
+      if (local_order_[i] == voice_handler_)
+        return i;
+    }
+    return -1;
+  }
+
+  void SoundEngine::prepareVoiceStage(int num_samples, double seconds) {
+    VITAL_ASSERT(num_samples <= output()->buffer_size);
+
+    if (shouldUpdate())
+      updateAllProcessors();
+
+    FloatVectorOperations::disableDenormalisedNumberSupport();
+    voice_handler_->correctToTime(seconds);
+    voice_handler_->setLegato(legato_->value());
+
+    ProcessorProfiler::Scope profile_scope(profiling_ ? profiler_.get() : nullptr);
+    ProcessorProfiler* profiler = ProcessorProfiler::active();
+    ProcessorProfiler::Entry* profile_entry = profiler ? profiler->current() : nullptr;
+
+    // The controls ahead of the voices are cheap and the effects read some of them, so they run here.
+    int normal_samples = std::max(1, num_samples / getOversampleAmount());
+    int voice_index = getVoiceHandlerIndex();
+    for (int i = 0; i < voice_index; ++i) {
+      Processor* processor = local_order_[i];
+      if (processor->enabled()) {
+        processor->process(normal_samples * processor->getOversampleAmount());
+        if (profiler)
+          profiler->processed(profile_entry);
+      }
+    }
+  }
+
+  void SoundEngine::processVoiceStage(int num_samples, PipelineBlock* block) {
+    FloatVectorOperations::disableDenormalisedNumberSupport();
+    ProcessorProfiler::Scope profile_scope(profiling_ ? profiler_.get() : nullptr);
+    int normal_samples = std::max(1, num_samples / getOversampleAmount());
+    int voice_samples = normal_samples * voice_handler_->getOversampleAmount();
+    if (voice_handler_->enabled())
+      voice_handler_->process(voice_samples);
+
+    if (getNumActiveVoices() == 0) {
+      CircularQueue<ModulationConnectionProcessor*>& connections = voice_handler_->enabledModulationConnection();
+      for (ModulationConnectionProcessor* modulation : connections) {
+        if (!modulation->isInputSourcePolyphonic())
+          modulation->process(num_samples);
+      }
+    }
+
+    utils::copyBuffer(block->audio.get(), voice_handler_->output()->buffer, voice_samples);
+    utils::copyBuffer(block->direct.get(), voice_handler_->getDirectOutput()->buffer, voice_samples);
+    block->keytrack = voice_handler_->midi_offset_output()->buffer[0];
+    block->num_samples = num_samples;
+  }
+
+  void SoundEngine::processEffectStage(const PipelineBlock* block, double seconds) {
+    FloatVectorOperations::disableDenormalisedNumberSupport();
+    effect_chain_->correctToTime(seconds);
+
+    ProcessorProfiler::Scope profile_scope(profiling_ ? effect_profiler_.get() : nullptr);
+    ProcessorProfiler* profiler = ProcessorProfiler::active();
+    ProcessorProfiler::Entry* profile_entry = profiler ? profiler->current() : nullptr;
+
+    int normal_samples = std::max(1, block->num_samples / getOversampleAmount());
+    int num_processors = local_order_.size();
+    for (int i = getVoiceHandlerIndex() + 1; i < num_processors; ++i) {
+      Processor* processor = local_order_[i];
+      if (!processor->enabled())
+        continue;
+
+      int processor_samples = normal_samples * processor->getOversampleAmount();
+      if (processor == effect_chain_) {
+        effect_chain_->setKeytrack(block->keytrack);
+        effect_chain_->processWithInput(block->audio.get(), processor_samples);
+      }
+      else if (processor == output_total_) {
+        poly_float* total = output_total_->output()->buffer;
+        const poly_float* effects = effect_chain_->output()->buffer;
+        for (int s = 0; s < processor_samples; ++s)
+          total[s] = effects[s] + block->direct[s];
+      }
+      else
+        processor->process(processor_samples);
+
+      if (profiler)
+        profiler->processed(profile_entry);
+    }
+  }
+
+  void SoundEngine::updateStatusOutputs() {
+    for (auto& status_source : data_->status_outputs)
+      status_source.second->update();
+  }
+
   ModulationConnectionBank& SoundEngine::getModulationBank() {
     return voice_handler_->getModulationBank();
   }
@@ -244,6 +413,7 @@ namespace vital {
 
     FloatVectorOperations::disableDenormalisedNumberSupport();
     voice_handler_->setLegato(legato_->value());
+    ProcessorProfiler::Scope profile_scope(profiling_ ? profiler_.get() : nullptr);
     ProcessorRouter::process(num_samples);
 
     if (getNumActiveVoices() == 0) {
@@ -254,8 +424,8 @@ namespace vital {
       }
     }
 
-    for (auto& status_source : data_->status_outputs)
-      status_source.second->update();
+    if (!lean_processing_)
+      updateStatusOutputs();
   }
 
   void SoundEngine::correctToTime(double seconds) {
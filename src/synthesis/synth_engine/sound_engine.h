@@ -20,6 +20,10 @@
 #include "synth_module.h"
 #include "note_handler.h"
 
+#include <memory>
+#include <string>
+#include <vector>
+
 class LineGenerator;
 class Tuning;
 
@@ -41,6 +45,18 @@ namespace vital {
       static constexpr int kDefaultOversamplingAmount = 2;
       static constexpr int kDefaultSampleRate = 44100;
 
+      // What the voice stage of a pipelined block hands to the effect stage.
+      struct PipelineBlock {
+        PipelineBlock() : audio(std::make_unique<poly_float[]>(kMaxBufferSize * kMaxOversample)),
+                          direct(std::make_unique<poly_float[]>(kMaxBufferSize * kMaxOversample)),
+                          keytrack(0.0f), num_samples(0) { }
+
+        std::unique_ptr<poly_float[]> audio;
+        std::unique_ptr<poly_float[]> direct;
+        poly_float keytrack;
+        int num_samples;
+      };
+
       SoundEngine();
       virtual ~SoundEngine();
 
@@ -52,6 +68,30 @@ namespace vital {
       void connectModulation(const modulation_change& change);
       void disconnectModulation(const modulation_change& change);
       int getNumActiveVoices();
+      int getNumAllocatedVoices();
+      int trimVoices();
+      void setLeanProcessing(bool lean);
+
+      // Pipelined processing splits each block in two so the effects of one block can run on another thread
+      // while the voices render the next. It matches process() as long as nothing that changes during the
+      // render crosses from the voices to the effects, so _changing_controls_ must only name voice controls.
+      bool canPipeline(const std::vector<std::string>& changing_controls);
+      // Called with both stages idle before each block's voice stage.
+      void prepareVoiceStage(int num_samples, double seconds);
+      void processVoiceStage(int num_samples, PipelineBlock* block);
+      // Leaves the status outputs alone since the voice stage may be updating them. Call updateStatusOutputs()
+      // once both stages are idle.
+      void processEffectStage(const PipelineBlock* block, double seconds);
+      void updateStatusOutputs();
+      force_inline bool isLeanProcessing() const { return lean_processing_; }
+
+      // Profiling charges processing time to module groups such as "osc_1" or "reverb". Turning it on starts
+      // a fresh profile. Audio is unchanged.
+      void setProfiling(bool profiling);
+      force_inline bool isProfiling() const { return profiling_; }
+      void resetProfile();
+      // Groups from both pipeline stages, busiest first.
+      std::vector<ProcessorProfiler::Report> getProfile() const;
       ModulationConnectionBank& getModulationBank();
       mono_float getLastActiveNote() const;
 
@@ -99,6 +139,7 @@ namespace vital {
 
     private:
       void setOversamplingAmount(int oversampling_amount, int sample_rate);
+      int getVoiceHandlerIndex();
     
       SynthVoiceHandler* voice_handler_;
       ReorderableEffectChain* effect_chain_;
@@ -111,6 +152,11 @@ namespace vital {
       Value* legato_;
       Decimator* decimator_;
       PeakMeter* peak_meter_;
+      bool lean_processing_;
+      bool profiling_;
+      // The effect stage of a pipelined render runs on another thread, so it has a profiler of its own.
+      std::unique_ptr<ProcessorProfiler> profiler_;
+      std::unique_ptr<ProcessorProfiler> effect_profiler_;
 
       CircularQueue<Processor*> modulation_processors_;
 
@@ -25,8 +25,14 @@
 #include "synth_gui_interface.cpp"
 #include "synth_parameters.cpp"
 #include "load_save.cpp"
+#include "binary_preset.cpp"
 #include "synth_types.cpp"
 #include "synth_base.cpp"
+#include "batch_renderer.cpp"
+#include "render_stream.cpp"
+#include "feature_extractor.cpp"
+#include "sweep_renderer.cpp"
+#include "render_sequence.cpp"
 #include "wavetable_component_factory.cpp"
 #include "wavetable_keyframe.cpp"
 #include "file_source.cpp"
@@ -35,6 +41,7 @@
 #include "wave_fold_modifier.cpp"
 #include "phase_modifier.cpp"
 #include "wavetable_creator.cpp"
+#include "wavetable_cache.cpp"
 #include "wave_line_source.cpp"
 #include "wave_source.cpp"
 #include "wavetable_group.cpp"
@@ -42,6 +42,7 @@
 #include "synth_module.cpp"
 #include "operators.cpp"
 #include "processor_router.cpp"
+#include "processor_profiler.cpp"
 #include "value.cpp"
 #include "trigger_random.cpp"
 #include "synth_lfo.cpp"
@@ -21,6 +21,16 @@ async function runTests() {
         }
     });
 
+    // In-memory rendering of the init preset (an empty preset path) needs no preset files
+    console.log('\nIn-memory batch with the init preset');
+    try {
+        const results = await renderer.renderBatchToBuffers(Array(8).fill(''));
+        const rendered = results.filter(r => r.success && r.audio && r.audio.length > 0).length;
+        console.log(`✓ Rendered ${rendered}/${results.length} buffers`);
+    } catch (error) {
+        console.error('✗ Failed:', error.message);
+    }
+
     // Test presets - using the 303 preset we tested earlier
     const testPreset = 'C:/Users/Riley/Desktop/SummerProject/2023AndBeyond/DanceMe/presetSorting/discord_presets/303.vital';
     
@@ -179,4 +179,573 @@ try {
     console.error('❌ Test failed:', error.message);
     console.error('Stack trace:', error.stack);
     process.exit(1);
-}
\ No newline at end of file
+}
+// Test 13: Async rendering off the main thread
+(async () => {
+    console.log('\n13. Testing async rendering...');
+    try {
+        const synth = new vita.Synth();
+        let ticks = 0;
+        const ticker = setInterval(() => ticks++, 1);
+
+        const [audioBuffer, sameBuffer] = await Promise.all([
+            synth.renderAsync(60, 0.8, 0.5, 1.0),
+            synth.renderAsync(60, 0.8, 0.5, 1.0)
+        ]);
+        clearInterval(ticker);
+        console.log('  Async buffer length:', audioBuffer.length);
+        console.log('  Event loop ticks during render:', ticks);
+        console.log('  Matches second render:', Buffer.compare(audioBuffer, sameBuffer) === 0);
+
+        const outputPath = path.join(__dirname, 'test_output_async.wav');
+        const success = await synth.renderFileAsync(outputPath, 60, 0.8, 0.1, 0.2);
+        console.log('  Async file render success:', success);
+        if (fs.existsSync(outputPath))
+            fs.unlinkSync(outputPath);
+
+        console.log('✓ Async rendering working\n');
+    } catch (e) {
+        console.error('❌ Async render failed:', e.message);
+        process.exitCode = 1;
+    }
+})();
+
+// Test 14: Zero-copy rendering into a caller-owned buffer
+console.log('14. Testing renderInto...');
+try {
+    const synth = new vita.Synth();
+    const expected = synth.render(60, 0.8, 0.1, 0.2);
+    const output = new Float32Array(expected.length / Float32Array.BYTES_PER_ELEMENT);
+    const samples = synth.renderInto(output, 60, 0.8, 0.1, 0.2);
+    console.log('  Samples per channel:', samples);
+    console.log('  Matches render():', Buffer.compare(Buffer.from(output.buffer), expected) === 0);
+
+    let threw = false;
+    try {
+        synth.renderInto(new Float32Array(16), 60, 0.8, 0.1, 0.2);
+    } catch (e) {
+        threw = e instanceof RangeError;
+    }
+    console.log('  Rejects undersized buffer:', threw);
+    console.log('✓ renderInto working\n');
+} catch (e) {
+    console.error('❌ renderInto failed:', e.message);
+    process.exitCode = 1;
+}
+
+// Test 15: Render options
+console.log('15. Testing render options...');
+try {
+    const synth = new vita.Synth();
+    const defaults = synth.render(60, 0.8, 0.1, 0.2);
+    const explicit = synth.render(60, 0.8, 0.1, 0.2, { sampleRate: 44100, blockSize: 64, bitDepth: 16 });
+    console.log('  Explicit defaults match:', Buffer.compare(defaults, explicit) === 0);
+
+    const hiRes = synth.render(60, 0.8, 0.1, 0.2, { sampleRate: 96000, blockSize: 128 });
+    const hiResSamples = hiRes.length / Float32Array.BYTES_PER_ELEMENT / 2;
+    console.log('  96 kHz samples per channel:', hiResSamples);
+    if (hiResSamples !== Math.floor(0.2 * 96000))
+        throw new Error('Unexpected sample count at 96 kHz');
+
+    const outputPath = path.join(__dirname, 'test_output_float.wav');
+    synth.renderFile(outputPath, 60, 0.8, 0.1, 0.2, { sampleRate: 48000, bitDepth: 32 });
+    const wav = fs.readFileSync(outputPath);
+    const fmt = wav.indexOf('fmt ') + 8;
+    console.log('  Float WAV rate:', wav.readUInt32LE(fmt + 4), 'bits:', wav.readUInt16LE(fmt + 14));
+    if (wav.readUInt32LE(fmt + 4) !== 48000 || wav.readUInt16LE(fmt + 14) !== 32)
+        throw new Error('Unexpected WAV format');
+    fs.unlinkSync(outputPath);
+
+    let threw = false;
+    try {
+        synth.render(60, 0.8, 0.1, 0.2, { blockSize: 4096 });
+    } catch (e) {
+        threw = e instanceof RangeError;
+    }
+    console.log('  Rejects oversized block:', threw);
+    console.log('✓ Render options working\n');
+} catch (e) {
+    console.error('❌ Render options failed:', e.message);
+    process.exitCode = 1;
+}
+
+// Test 16: Event sequence rendering
+console.log('16. Testing renderSequence...');
+try {
+    const synth = new vita.Synth();
+    const events = [
+        { type: 'noteOn', sample: 1000, note: 60, velocity: 0.8 },
+        { type: 'noteOn', time: 0.25, note: 64, velocity: 0.6 },
+        { type: 'pitchBend', time: 0.3, value: 0.25 },
+        { type: 'modWheel', time: 0.3, value: 0.5 },
+        { type: 'noteOff', time: 0.5, note: 60 },
+        { type: 'noteOff', time: 0.5, note: 64 }
+    ];
+    const audio = synth.renderSequence(events, 1.0);
+    const samples = new Float32Array(audio.buffer, audio.byteOffset, audio.length / Float32Array.BYTES_PER_ELEMENT);
+    const perChannel = samples.length / 2;
+    console.log('  Samples per channel:', perChannel);
+    console.log('  Silent before first note:', samples.subarray(0, 1000).every(v => v === 0));
+    console.log('  Sound after first note:', samples.subarray(1000, perChannel).some(v => v !== 0));
+
+    // Minimal format 0 MIDI file: 96 ticks per quarter, one note for a quarter note at 120 bpm.
+    const midiPath = path.join(__dirname, 'test_sequence.mid');
+    fs.writeFileSync(midiPath, Buffer.from([
+        0x4d, 0x54, 0x68, 0x64, 0, 0, 0, 6, 0, 0, 0, 1, 0, 96,
+        0x4d, 0x54, 0x72, 0x6b, 0, 0, 0, 12,
+        0x00, 0x90, 60, 100,
+        0x60, 0x80, 60, 0,
+        0x00, 0xff, 0x2f, 0x00
+    ]));
+    const outputPath = path.join(__dirname, 'test_output_sequence.wav');
+    const success = synth.renderSequenceFile(outputPath, midiPath, 1.0, { bitDepth: 24 });
+    console.log('  MIDI file render success:', success);
+    fs.unlinkSync(midiPath);
+    if (fs.existsSync(outputPath))
+        fs.unlinkSync(outputPath);
+
+    let threw = false;
+    try {
+        synth.renderSequence([{ type: 'bogus', time: 0 }], 1.0);
+    } catch (e) {
+        threw = e instanceof TypeError;
+    }
+    console.log('  Rejects unknown event type:', threw);
+    console.log('✓ renderSequence working\n');
+} catch (e) {
+    console.error('❌ renderSequence failed:', e.message);
+    process.exitCode = 1;
+}
+
+// Test 17: Parameter automation during render
+console.log('17. Testing automation lanes...');
+try {
+    const synth = new vita.Synth();
+    const controls = synth.getControls();
+    const levelBefore = controls.osc_1_level.value();
+    const audio = synth.render(60, 0.8, 1.0, 1.0, {
+        automation: [{ name: 'osc_1_level', times: [0, 1], values: [0, 1] }]
+    });
+    const samples = new Float32Array(audio.buffer, audio.byteOffset, audio.length / Float32Array.BYTES_PER_ELEMENT);
+    const energy = (from, to) => samples.subarray(from, to).reduce((sum, v) => sum + v * v, 0);
+    const quarter = Math.floor(samples.length / 2 / 4);
+    console.log('  Rising level:', energy(0, quarter) < energy(2 * quarter, 3 * quarter));
+    console.log('  Control restored:', controls.osc_1_level.value() === levelBefore);
+
+    // Dense curve given as a Float32Array at 100 values per second, in normalized units
+    const sweep = new Float32Array(100).map((_, i) => i / 99);
+    synth.render(60, 0.8, 1.0, 1.0, {
+        automation: [{ name: 'filter_1_cutoff', values: sweep, rate: 100, normalized: true }]
+    });
+
+    let threw = false;
+    try {
+        synth.render(60, 0.8, 1.0, 1.0, { automation: [{ name: 'not_a_control', times: [0], values: [0] }] });
+    } catch (e) {
+        threw = e instanceof TypeError;
+    }
+    console.log('  Rejects unknown control:', threw);
+    console.log('✓ Automation working\n');
+} catch (e) {
+    console.error('❌ Automation failed:', e.message);
+    process.exitCode = 1;
+}
+
+// Test 18: Wavetable cache
+console.log('18. Testing wavetable cache...');
+try {
+    vita.clearWavetableCache();
+    const source = new vita.Synth();
+    const json = source.toJson();
+
+    const first = new vita.Synth();
+    first.loadJson(json);
+    const afterFirst = vita.getWavetableCacheStats();
+    const second = new vita.Synth();
+    second.loadJson(json);
+    const afterSecond = vita.getWavetableCacheStats();
+    console.log('  Stats:', afterSecond);
+    console.log('  Reload hits cache:', afterSecond.hits > afterFirst.hits && afterSecond.misses === afterFirst.misses);
+
+    const a = first.render(60, 0.8, 0.5, 0.5);
+    const b = second.render(60, 0.8, 0.5, 0.5);
+    console.log('  Same length after cached load:', a.length === b.length);
+
+    vita.setWavetableCacheSize(0);
+    console.log('  Disabled cache is empty:', vita.getWavetableCacheStats().size === 0);
+    vita.setWavetableCacheSize(32);
+
+    let threw = false;
+    try {
+        vita.setWavetableCacheSize(-1);
+    } catch (e) {
+        threw = e instanceof RangeError;
+    }
+    console.log('  Rejects negative size:', threw);
+    console.log('✓ Wavetable cache working\n');
+} catch (e) {
+    console.error('❌ Wavetable cache failed:', e.message);
+    process.exitCode = 1;
+}
+
+// Test 19: Binary presets
+console.log('19. Testing binary presets...');
+try {
+    const synth = new vita.Synth();
+    synth.getControls().osc_1_level.set(0.25);
+    const json = synth.toJson();
+
+    const binary = vita.presetJsonToBinary(json);
+    console.log('  Smaller than json:', binary.length < Buffer.byteLength(json));
+    console.log('  Lossless round trip:', JSON.stringify(JSON.parse(vita.presetBinaryToJson(binary))) === JSON.stringify(JSON.parse(json)));
+
+    const other = new vita.Synth();
+    console.log('  loadBinary:', other.loadBinary(synth.toBinary()));
+    console.log('  Control restored:', Math.abs(other.getControls().osc_1_level.value() - 0.25) < 1e-6);
+
+    const presetPath = path.join(__dirname, 'test_binary_preset.vitalb');
+    console.log('  saveBinaryPreset:', synth.saveBinaryPreset(presetPath));
+    console.log('  loadPreset detects binary:', other.loadPreset(presetPath));
+    if (fs.existsSync(presetPath))
+        fs.unlinkSync(presetPath);
+
+    let threw = false;
+    try {
+        vita.presetBinaryToJson(Buffer.from('not a preset at all, just some bytes'));
+    } catch (e) {
+        threw = true;
+    }
+    console.log('  Rejects garbage:', threw);
+    console.log('✓ Binary presets working\n');
+} catch (e) {
+    console.error('❌ Binary presets failed:', e.message);
+    process.exitCode = 1;
+}
+
+// Test 20: Lazy voice allocation
+console.log('20. Testing lazy voice allocation...');
+try {
+    const synth = new vita.Synth();
+    console.log('  Voices before rendering:', synth.getNumAllocatedVoices());
+    synth.render(60, 0.8, 0.5, 1.0);
+    const allocated = synth.getNumAllocatedVoices();
+    console.log('  Voices after one note:', allocated);
+    console.log('  Trimmed:', synth.trimVoices());
+    console.log('  Voices after trim:', synth.getNumAllocatedVoices());
+    const audio = synth.render(60, 0.8, 0.5, 1.0);
+    console.log('  Renders after trim:', audio.length > 0);
+    console.log('✓ Lazy voice allocation working\n');
+} catch (e) {
+    console.error('❌ Lazy voice allocation failed:', e.message);
+    process.exitCode = 1;
+}
+
+// Test 21: Lean processing
+console.log('21. Testing lean processing...');
+try {
+    const synth = new vita.Synth();
+    const full = synth.render(60, 0.8, 0.5, 1.0);
+    const lean = synth.render(60, 0.8, 0.5, 1.0, { lean: true });
+    console.log('  Lean render length matches:', lean.length === full.length);
+    console.log('  Synth still full after lean render:', !synth.isLeanProcessing());
+    synth.setLeanProcessing(true);
+    console.log('  Synth lean:', synth.isLeanProcessing());
+    console.log('  Renders while lean:', synth.render(60, 0.8, 0.5, 1.0).length > 0);
+    console.log('✓ Lean processing working\n');
+} catch (e) {
+    console.error('❌ Lean processing failed:', e.message);
+    process.exitCode = 1;
+}
+
+// Test 22: Stopping on silence
+console.log('22. Testing stopOnSilence...');
+try {
+    const synth = new vita.Synth();
+    const full = synth.render(60, 0.8, 0.2, 5.0);
+    const short = synth.render(60, 0.8, 0.2, 5.0, { stopOnSilence: true });
+    const samples = audio => audio.length / Float32Array.BYTES_PER_ELEMENT / 2;
+    console.log('  Full length:', samples(full), 'samples, stopped at:', samples(short));
+    console.log('  Stopped early:', short.length < full.length);
+    console.log('✓ stopOnSilence working\n');
+} catch (e) {
+    console.error('❌ stopOnSilence failed:', e.message);
+    process.exitCode = 1;
+}
+
+// Test 23: Pipelined rendering
+console.log('23. Testing pipelined rendering...');
+try {
+    const synth = new vita.Synth();
+    const audio = synth.render(60, 0.8, 0.5, 1.0, { pipelined: true });
+    console.log('  Pipelined render length:', audio.length / Float32Array.BYTES_PER_ELEMENT / 2);
+    const sequence = synth.renderSequence([{ type: 'noteOn', time: 0, note: 60, velocity: 0.8 },
+                                           { type: 'noteOff', time: 0.5, note: 60 }], 1.0, { pipelined: true });
+    console.log('  Pipelined sequence renders:', sequence.length > 0);
+    console.log('✓ Pipelined rendering working\n');
+} catch (e) {
+    console.error('❌ Pipelined rendering failed:', e.message);
+    process.exitCode = 1;
+}
+
+// Test 24: Bulk control access
+console.log('24. Testing bulk control access...');
+try {
+    const synth = new vita.Synth();
+    const names = synth.getControlNames();
+    const values = synth.getControls(new Float32Array(names.length));
+    const cutoff = names.indexOf('filter_1_cutoff');
+    console.log('  Matches ControlValue:', values[cutoff] === Math.fround(synth.getControls().filter_1_cutoff.value()));
+
+    const normalized = synth.getControlsNormalized(new Float32Array(names.length));
+    normalized[cutoff] = 0.25;
+    synth.setControlsNormalized(normalized);
+    console.log('  Normalized set applied:',
+                Math.abs(synth.getControls().filter_1_cutoff.getNormalized() - 0.25) < 1e-4);
+
+    values[cutoff] = 60;
+    synth.setControls(values);
+    console.log('  Raw set applied:', synth.getControls().filter_1_cutoff.value() === 60);
+    console.log('✓ Bulk control access working\n');
+} catch (e) {
+    console.error('❌ Bulk control access failed:', e.message);
+    process.exitCode = 1;
+}
+
+// Test 25: Seeded renders
+console.log('25. Testing seeded renders...');
+try {
+    const first = new vita.Synth();
+    const second = new vita.Synth();
+    const seeded = first.render(60, 0.8, 0.5, 1.0, { seed: 1234 });
+    first.render(64, 0.8, 0.5, 1.0);
+    console.log('  Repeatable on one synth:', seeded.equals(first.render(60, 0.8, 0.5, 1.0, { seed: 1234 })));
+    console.log('  Repeatable across synths:', seeded.equals(second.render(60, 0.8, 0.5, 1.0, { seed: 1234 })));
+    console.log('  Other seeds differ:', !seeded.equals(second.render(60, 0.8, 0.5, 1.0, { seed: 4321 })));
+
+    const firstPath = path.join(__dirname, 'seeded_first.wav');
+    const secondPath = path.join(__dirname, 'seeded_second.wav');
+    first.renderFile(firstPath, 60, 0.8, 0.5, 1.0, { seed: 1234 });
+    second.renderFile(secondPath, 60, 0.8, 0.5, 1.0, { seed: 1234 });
+    console.log('  Files repeatable across synths:', fs.readFileSync(firstPath).equals(fs.readFileSync(secondPath)));
+    fs.unlinkSync(firstPath);
+    fs.unlinkSync(secondPath);
+    console.log('✓ Seeded renders working\n');
+} catch (e) {
+    console.error('❌ Seeded renders failed:', e.message);
+    process.exitCode = 1;
+}
+
+// Test 26: Multithreaded wavetable rendering
+console.log('26. Testing wavetable render threads...');
+try {
+    const synth = new vita.Synth();
+    const expected = synth.render(60, 0.8, 0.5, 1.0, { seed: 7 });
+    synth.setWavetableRenderThreads(4);
+    console.log('  Render threads:', synth.getWavetableRenderThreads());
+    synth.loadJson(synth.toJson());
+    console.log('  Same audio after threaded load:', expected.equals(synth.render(60, 0.8, 0.5, 1.0, { seed: 7 })));
+
+    // A spectral morph to a sine across the whole table runs a Fourier transform on every frame, so
+    // threads sharing the transform would corrupt frames.
+    const state = JSON.parse(synth.toJson());
+    const component = state.settings.wavetables[0].groups[0].components[0];
+    const sine = new Float32Array(2048).map((_, i) => Math.sin(2 * Math.PI * i / 2048));
+    component.interpolation = 1;
+    component.keyframes.push({ ...component.keyframes[0], position: 256,
+                               wave_data: Buffer.from(sine.buffer).toString('base64') });
+    const renderFrames = (threads) => {
+        const frameSynth = new vita.Synth();
+        frameSynth.setWavetableRenderThreads(threads);
+        frameSynth.loadJson(JSON.stringify(state));
+        const renders = [];
+        for (let frame = 0; frame <= 256; frame += 32) {
+            frameSynth.getControls().osc_1_wave_frame.set(frame);
+            renders.push(frameSynth.render(60, 0.8, 0.1, 0.2, { seed: 7 }));
+        }
+        return Buffer.concat(renders);
+    };
+    // The cache would hand later loads the serial table, so every load has to render.
+    vita.setWavetableCacheSize(0);
+    try {
+        const serial = renderFrames(1);
+        for (let i = 0; i < 8; ++i) {
+            if (!serial.equals(renderFrames(8)))
+                throw new Error('Threaded wavetable differs from the serial render');
+        }
+    } finally {
+        vita.setWavetableCacheSize(32);
+    }
+    console.log('  Threaded morph matches serial: true');
+    console.log('✓ Wavetable render threads working\n');
+} catch (e) {
+    console.error('❌ Wavetable render threads failed:', e.message);
+    process.exitCode = 1;
+}
+
+// Test 27: Incremental wavetable edits
+console.log('27. Testing setWavetableKeyframe...');
+try {
+    const synth = new vita.Synth();
+    const state = JSON.parse(synth.toJson());
+    const keyframes = state.settings.wavetables[0].groups[0].components[0].keyframes;
+    for (const position of [64, 128, 192, 256])
+        keyframes.push({ ...keyframes[0], position });
+    synth.loadJson(JSON.stringify(state));
+    console.log('  First edit frames:', synth.setWavetableKeyframe(0, 0, 0, 2, JSON.stringify({ position: 100 })));
+    console.log('  Second edit frames:', synth.setWavetableKeyframe(0, 0, 0, 2, JSON.stringify({ position: 120 })));
+
+    const reloaded = new vita.Synth();
+    reloaded.loadJson(synth.toJson());
+    const edited = synth.render(60, 0.8, 0.5, 1.0, { seed: 3 });
+    console.log('  Same audio as a full render:', edited.equals(reloaded.render(60, 0.8, 0.5, 1.0, { seed: 3 })));
+    console.log('✓ setWavetableKeyframe working\n');
+} catch (e) {
+    console.error('❌ setWavetableKeyframe failed:', e.message);
+    process.exitCode = 1;
+}
+
+// Test 28: Feature extraction
+console.log('28. Testing render features...');
+try {
+    const synth = new vita.Synth();
+    const audio = synth.render(57, 0.8, 0.5, 1.0, { seed: 5 });
+    const result = synth.render(57, 0.8, 0.5, 1.0, {
+        seed: 5,
+        features: { spectrogram: true, mel: true, rms: true, pitch: true, fftSize: 1024, hopSize: 256 }
+    });
+    console.log('  Audio unchanged:', audio.equals(result.audio));
+    console.log('  Frames:', result.frames, 'bins:', result.bins, 'mel bands:', result.melBands);
+    console.log('  Sizes match:', result.spectrogram.length === result.frames * result.bins &&
+                result.mel.length === result.frames * result.melBands &&
+                result.rms.length === result.frames && result.pitch.length === result.frames);
+    console.log('  Pitch of A3:', result.pitch[4].toFixed(1), 'Hz');
+
+    const featuresOnly = synth.render(57, 0.8, 0.5, 1.0, { features: { rms: true, audio: false } });
+    console.log('  Audio skipped:', featuresOnly.audio === undefined && featuresOnly.rms.length > 0);
+
+    let rejected = false;
+    try {
+        synth.renderFile(path.join(__dirname, 'features.wav'), 57, 0.8, 0.5, 1.0, { features: { rms: true } });
+    } catch (e) {
+        rejected = e instanceof TypeError;
+    }
+    console.log('  Rejected by renderFile:', rejected);
+    console.log('✓ Render features working\n');
+} catch (e) {
+    console.error('❌ Render features failed:', e.message);
+    process.exitCode = 1;
+}
+
+// Test 29: Per-module profiling
+console.log('29. Testing render profiling...');
+try {
+    const synth = new vita.Synth();
+    const audio = synth.render(60, 0.8, 0.5, 1.0, { seed: 3 });
+    synth.setProfiling(true);
+    const profiled = synth.render(60, 0.8, 0.5, 1.0, { seed: 3 });
+    const profile = synth.getProfile();
+    const groups = Object.keys(profile);
+    console.log('  Audio unchanged:', audio.equals(profiled));
+    console.log('  Groups:', groups.join(', '));
+    console.log('  Has engine, voices and osc_1:', ['engine', 'voices', 'osc_1'].every(name => name in profile));
+    console.log('  Busiest first:', groups.every((name, i) => i === 0 || profile[groups[i - 1]].cycles >= profile[name].cycles));
+    synth.resetProfile();
+    console.log('  Empty after reset:', Object.keys(synth.getProfile()).length === 0);
+    synth.setProfiling(false);
+    console.log('✓ Render profiling working\n');
+} catch (e) {
+    console.error('❌ Render profiling failed:', e.message);
+    process.exitCode = 1;
+}
+
+// Test 30: Building a pool of synths
+(async () => {
+    console.log('\n30. Testing createSynths...');
+    try {
+        const start = Date.now();
+        const synths = await vita.createSynths(8);
+        console.log('  Synths created:', synths.length, `in ${Date.now() - start} ms`);
+        console.log('  All are Synth instances:', synths.every(synth => synth instanceof vita.Synth));
+        const audio = synths[synths.length - 1].render(60, 0.8, 0.1, 0.2);
+        console.log('  Pooled synth renders:', audio.length > 0);
+        let rejected = false;
+        try {
+            await vita.createSynths(1 << 20);
+        } catch (e) {
+            rejected = e instanceof RangeError;
+        }
+        console.log('  Oversized pool rejected:', rejected);
+        if (!rejected)
+            throw new Error('createSynths accepted an oversized pool');
+        console.log('✓ createSynths working\n');
+    } catch (e) {
+        console.error('❌ createSynths failed:', e.message);
+        process.exitCode = 1;
+    }
+
+    // Test 31: Streaming a render
+    console.log('31. Testing renderStream...');
+    try {
+        const synth = new vita.Synth();
+        const expected = synth.render(60, 0.8, 0.5, 1.0).length;
+        let bytes = 0;
+        let chunks = 0;
+        for await (const chunk of synth.renderStream(60, 0.8, 0.5, 1.0, { chunkSize: 1024 })) {
+            bytes += chunk.length;
+            chunks++;
+        }
+        console.log('  Chunks streamed:', chunks);
+        console.log('  Same length as render():', bytes === expected);
+
+        const stream = synth.renderStream(60, 0.8, 0.5, 10.0);
+        let busy = false;
+        try {
+            synth.render(60, 0.8, 0.1, 0.1);
+        } catch (e) {
+            busy = true;
+        }
+        stream.destroy();
+        console.log('  Synth busy while streaming:', busy);
+        console.log('✓ renderStream working\n');
+    } catch (e) {
+        console.error('❌ renderStream failed:', e.message);
+        process.exitCode = 1;
+    }
+
+    // Test 32: Parameter sweep
+    console.log('32. Testing renderSweep...');
+    try {
+        const synth = new vita.Synth();
+        const before = synth.getControls().filter_1_cutoff.value();
+        const values = [0, 0.25, 0.5, 0.75, 1];
+        const audio = await synth.renderSweep('filter_1_cutoff', values, 60, 0.8, 0.5, 1.0,
+                                              { normalized: true, threads: 2 });
+        const floats = audio.length / Float32Array.BYTES_PER_ELEMENT;
+        console.log('  One render per value:', floats === values.length * 2 * 44100);
+        console.log('  Control restored:', synth.getControls().filter_1_cutoff.value() === before);
+        console.log('✓ renderSweep working\n');
+    } catch (e) {
+        console.error('❌ renderSweep failed:', e.message);
+        process.exitCode = 1;
+    }
+
+    // Test 33: Errors thrown from a batch progress callback
+    console.log('33. Testing batch callback errors...');
+    try {
+        const renderer = new vita.BatchRenderer({ workers: 2 });
+        const presets = ['missing_1.vital', 'missing_2.vital', 'missing_3.vital'];
+        let message = null;
+        try {
+            await renderer.renderBatchToBuffers(presets, { renderDuration: 0.1 }, () => {
+                throw new Error('progress failed');
+            });
+        } catch (e) {
+            message = e.message;
+        }
+        console.log('  Batch rejected with the callback error:', message === 'progress failed');
+        console.log('✓ Batch callback errors working\n');
+    } catch (e) {
+        console.error('❌ Batch callback errors failed:', e.message);
+        process.exitCode = 1;
+    }
+})();
@@ -159,7 +159,10 @@ int runAllTests() {
   return getResult(test_runner);
 }
 
-int runTests(int argc) {
+// vital_tests <category> <name> runs one test, any single argument skips the interface tests.
+int runTests(int argc, char* argv[]) {
+  if (argc > 2)
+    return runSingleTest(argv[1], argv[2]);
   if (argc > 1)
     return runNonGraphicalTests();
 
@@ -167,7 +170,7 @@ int runTests(int argc) {
 }
 
 int main(int argc, char* argv[]) {
-  int result = runTests(argc);
+  int result = runTests(argc, argv);
 
   DeletedAtShutdown::deleteAll();
   MessageManager::deleteInstance();
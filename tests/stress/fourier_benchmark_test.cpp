@@ -0,0 +1,215 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fourier_benchmark_test.h"
+#include "fourier_transform.h"
+#include "kissfft/kissfft.h"
+#include "wave_frame.h"
+
+#include <atomic>
+#include <thread>
+
+namespace {
+  constexpr int kMinBits = 4;
+  constexpr int kMaxBits = 14;
+  constexpr int kNumTransforms = 20000;
+  constexpr int kNumThreads = 4;
+  constexpr int kNumConcurrentTransforms = 2000;
+  constexpr float kMaxRelativeError = 0.00001f;
+
+  void fillRandom(Random& random, float* data, int num) {
+    for (int i = 0; i < num; ++i)
+      data[i] = 2.0f * random.nextFloat() - 1.0f;
+  }
+
+  float maxDifference(const float* one, const float* two, int num) {
+    float difference = 0.0f;
+    for (int i = 0; i < num; ++i)
+      difference = std::max(difference, std::abs(one[i] - two[i]));
+    return difference;
+  }
+
+  // Same packing and scaling as the kissfft FourierTransform backend so every backend does the same work.
+  class KissRealTransform {
+    public:
+      KissRealTransform(int bits) : size_(1 << bits), forward_(size_, false), inverse_(size_, true) {
+        buffer_ = std::make_unique<std::complex<float>[]>(size_);
+      }
+
+      void transformRealForward(float* data) {
+        for (int i = size_ - 1; i >= 0; --i) {
+          data[2 * i] = data[i];
+          data[2 * i + 1] = 0.0f;
+        }
+
+        forward_.transform((std::complex<float>*)data, buffer_.get());
+        memcpy(data, buffer_.get(), 2 * size_ * sizeof(float));
+        data[size_] = data[1];
+        data[size_ + 1] = 0.0f;
+        data[1] = 0.0f;
+      }
+
+      void transformRealInverse(float* data) {
+        data[0] *= 0.5f;
+        data[1] = data[size_];
+        inverse_.transform((std::complex<float>*)data, buffer_.get());
+
+        float multiplier = 2.0f / size_;
+        for (int i = 0; i < size_; ++i)
+          data[i] = buffer_[i].real() * multiplier;
+        memset(data + size_, 0, size_ * sizeof(float));
+      }
+
+    private:
+      int size_;
+      std::unique_ptr<std::complex<float>[]> buffer_;
+      kissfft<float> forward_;
+      kissfft<float> inverse_;
+  };
+
+  class JuceRealTransform {
+    public:
+      JuceRealTransform(int bits) : fft_(bits) { }
+
+      void transformRealForward(float* data) { fft_.performRealOnlyForwardTransform(data, true); }
+      void transformRealInverse(float* data) { fft_.performRealOnlyInverseTransform(data); }
+
+    private:
+      dsp::FFT fft_;
+  };
+
+  template<class Transform>
+  double timeTransforms(Transform& transform, float* data) {
+    int64 start = Time::getHighResolutionTicks();
+    for (int i = 0; i < kNumTransforms; ++i) {
+      data[1] = i;
+      transform.transformRealForward(data);
+      transform.transformRealInverse(data);
+    }
+    double seconds = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start);
+    return 1000000.0 * seconds / (2.0 * kNumTransforms);
+  }
+} // namespace
+
+void FourierBenchmarkTest::accuracyTest() {
+  beginTest("SIMD Fourier Transform Accuracy");
+
+  Random random(1);
+  for (int bits = kMinBits; bits <= kMaxBits; ++bits) {
+    int size = 1 << bits;
+    vital::SimdFourierTransform simd(bits);
+    JuceRealTransform reference(bits);
+    std::vector<float> simd_data(2 * size);
+    std::vector<float> reference_data(2 * size);
+
+    fillRandom(random, simd_data.data(), size);
+    std::vector<float> original(simd_data.begin(), simd_data.begin() + size);
+    reference_data = simd_data;
+    simd.transformRealForward(simd_data.data());
+    reference.transformRealForward(reference_data.data());
+    expect(maxDifference(simd_data.data(), reference_data.data(), size + 2) < kMaxRelativeError * size);
+
+    simd.transformRealInverse(simd_data.data());
+    expect(maxDifference(simd_data.data(), original.data(), size) < kMaxRelativeError);
+    for (int i = size; i < 2 * size; ++i)
+      expect(simd_data[i] == 0.0f);
+
+    fillRandom(random, simd_data.data(), size + 2);
+    simd_data[1] = simd_data[size + 1] = 0.0f;
+    reference_data = simd_data;
+    simd.transformRealInverse(simd_data.data());
+    reference.transformRealInverse(reference_data.data());
+    expect(maxDifference(simd_data.data(), reference_data.data(), size) < kMaxRelativeError);
+  }
+}
+
+void FourierBenchmarkTest::concurrentTest() {
+  beginTest("SIMD Fourier Transform Concurrent Use");
+
+  // FFT<bits> hands every thread the same transform so one instance has to work from several threads.
+  static constexpr int kBits = vital::WaveFrame::kWaveformBits;
+  static constexpr int kSize = 1 << kBits;
+
+  vital::SimdFourierTransform simd(kBits);
+  std::vector<std::vector<float>> inputs(kNumThreads);
+  std::vector<std::vector<float>> expected(kNumThreads);
+  Random random(1);
+  for (int t = 0; t < kNumThreads; ++t) {
+    inputs[t].resize(2 * kSize);
+    fillRandom(random, inputs[t].data(), kSize);
+    expected[t] = inputs[t];
+    simd.transformRealForward(expected[t].data());
+  }
+
+  std::atomic<int> num_errors(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      std::vector<float> data(2 * kSize);
+      for (int i = 0; i < kNumConcurrentTransforms; ++i) {
+        data = inputs[t];
+        simd.transformRealForward(data.data());
+        if (maxDifference(data.data(), expected[t].data(), kSize + 2) != 0.0f)
+          num_errors++;
+
+        simd.transformRealInverse(data.data());
+        if (maxDifference(data.data(), inputs[t].data(), kSize) > kMaxRelativeError)
+          num_errors++;
+      }
+    });
+  }
+  for (std::thread& thread : threads)
+    thread.join();
+
+  expectEquals(num_errors.load(), 0);
+}
+
+void FourierBenchmarkTest::backendBenchmark() {
+  beginTest("Fourier Backend Benchmark");
+
+  static constexpr int kBits = vital::WaveFrame::kWaveformBits;
+  static constexpr int kSize = 1 << kBits;
+
+  vital::SimdFourierTransform simd(kBits);
+  JuceRealTransform juce(kBits);
+  KissRealTransform kiss(kBits);
+  vital::FourierTransform selected(kBits);
+  float data[2 * kSize] = { 0.0f };
+  Random random(1);
+  fillRandom(random, data, kSize);
+
+  timeTransforms(selected, data);
+  double simd_time = timeTransforms(simd, data);
+  double juce_time = timeTransforms(juce, data);
+  double kiss_time = timeTransforms(kiss, data);
+  double selected_time = timeTransforms(selected, data);
+  bool finite = true;
+  for (float value : data)
+    finite = finite && std::isfinite(value);
+  expect(finite);
+
+  logMessage(String(kSize) + " point real transform - SIMD: " + String(simd_time, 2) + " us, juce: " +
+             String(juce_time, 2) + " us, kissfft: " + String(kiss_time, 2) + " us, FourierTransform: " +
+             String(selected_time, 2) + " us");
+}
+
+void FourierBenchmarkTest::runTest() {
+  accuracyTest();
+  concurrentTest();
+  backendBenchmark();
+}
+
+static FourierBenchmarkTest fourier_benchmark_test;
@@ -0,0 +1,91 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "render_benchmark_test.h"
+#include "sound_engine.h"
+
+namespace {
+  constexpr int kBlockSize = 64;
+  constexpr int kNumBlocks = 2000;
+  constexpr int kNumRounds = 5;
+  const int kChord[] = { 48, 55, 60, 64, 67, 71 };
+
+  // A bare engine has an empty wavetable, so switch the sampler on as well to get some signal.
+  void turnSoundOn(vital::SoundEngine* engine) {
+    vital::control_map controls = engine->getControls();
+    controls["osc_1_on"]->set(1.0f);
+    controls["sample_on"]->set(1.0f);
+  }
+} // namespace
+
+double RenderBenchmarkTest::timeBlocks(vital::SoundEngine& engine, int num_blocks) {
+  int64 start = Time::getHighResolutionTicks();
+  for (int i = 0; i < num_blocks; ++i)
+    engine.process(kBlockSize);
+  return Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start);
+}
+
+void RenderBenchmarkTest::leanStatusTest() {
+  beginTest("Lean Status Outputs");
+
+  vital::SoundEngine engine;
+  const vital::StatusOutput* peak = engine.getStatusOutput("peak_meter");
+  expect(peak != nullptr);
+
+  turnSoundOn(&engine);
+  engine.setLeanProcessing(true);
+  expect(engine.isLeanProcessing());
+  engine.noteOn(60, 1.0f, 0, 0);
+  timeBlocks(engine, kNumBlocks / 10);
+  expect(vital::utils::isFinite(engine.output()->buffer, kBlockSize));
+  expect(peak->value()[0] == 0.0f);
+
+  engine.setLeanProcessing(false);
+  timeBlocks(engine, kNumBlocks / 10);
+  expect(peak->value()[0] > 0.0f);
+}
+
+void RenderBenchmarkTest::leanBenchmark() {
+  beginTest("Lean Render Benchmark");
+
+  vital::SoundEngine engine;
+  turnSoundOn(&engine);
+  for (int note : kChord)
+    engine.noteOn(note, 1.0f, 0, 0);
+  timeBlocks(engine, kNumBlocks / 10);
+
+  // Alternate the modes on one engine so both see the same voices and the same cache state.
+  double full_time = 0.0;
+  double lean_time = 0.0;
+  for (int i = 0; i < kNumRounds; ++i) {
+    engine.setLeanProcessing(false);
+    full_time += timeBlocks(engine, kNumBlocks);
+    engine.setLeanProcessing(true);
+    lean_time += timeBlocks(engine, kNumBlocks);
+  }
+  expect(vital::utils::isFinite(engine.output()->buffer, kBlockSize));
+
+  double num_blocks = kNumRounds * kNumBlocks;
+  logMessage("Full: " + String(1000000.0 * full_time / num_blocks, 2) + " us/block, lean: " +
+             String(1000000.0 * lean_time / num_blocks, 2) + " us/block");
+}
+
+void RenderBenchmarkTest::runTest() {
+  leanStatusTest();
+  leanBenchmark();
+}
+
+static RenderBenchmarkTest render_benchmark_test;
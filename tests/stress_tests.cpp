@@ -16,3 +16,5 @@
 
 #include "stress/modulation_stress_test.cpp"
 #include "stress/engine_launch_test.cpp"
+#include "stress/render_benchmark_test.cpp"
+#include "stress/fourier_benchmark_test.cpp"
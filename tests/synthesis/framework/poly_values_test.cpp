@@ -22,6 +22,7 @@
 void PolyValuesTest::runTest() {
   runFloatTests();
   runIntTests();
+  runBackendTests();
 }
 
 void PolyValuesTest::runFloatTests() {
@@ -269,4 +270,93 @@ void PolyValuesTest::runIntTests() {
   expect(vital::poly_float::equal(compare, 5.0f).anyMask() == 0);
 }
 
+// Checks every lane against plain scalar math so the SSE2, AVX2 and NEON builds all agree.
+void PolyValuesTest::runBackendTests() {
+  static constexpr int kSize = vital::poly_float::kSize;
+  float float_one[kSize];
+  float float_two[kSize];
+  uint32_t int_one[kSize];
+  uint32_t int_two[kSize];
+  for (int i = 0; i < kSize; ++i) {
+    float_one[i] = 0.75f * i - 2.5f;
+    float_two[i] = (i % 3) * 1.25f + 0.5f;
+    int_one[i] = i * 7919 - 20000;
+    int_two[i] = (i % 2) ? -3 * i : 5 * i + 1;
+  }
+
+  beginTest("Backend Floats");
+  vital::poly_float one = vital::poly_float::load(float_one);
+  vital::poly_float two = vital::poly_float::load(float_two);
+  vital::poly_float add = one + two;
+  vital::poly_float subtract = one - two;
+  vital::poly_float multiply = one * two;
+  vital::poly_float divide = one / two;
+  vital::poly_float mul_add = vital::poly_float::mulAdd(one, two, one);
+  vital::poly_float mul_sub = vital::poly_float::mulSub(one, two, one);
+  vital::poly_float max = vital::poly_float::max(one, two);
+  vital::poly_float min = vital::poly_float::min(one, two);
+  vital::poly_float abs = vital::poly_float::abs(one);
+  vital::poly_mask greater = vital::poly_float::greaterThan(one, two);
+  vital::poly_mask not_equal = vital::poly_float::notEqual(one, two);
+  float total = 0.0f;
+  for (int i = 0; i < kSize; ++i) {
+    expect(add[i] == float_one[i] + float_two[i]);
+    expect(subtract[i] == float_one[i] - float_two[i]);
+    expect(multiply[i] == float_one[i] * float_two[i]);
+    expectWithinAbsoluteError(divide[i], float_one[i] / float_two[i], EPSILON);
+    expectWithinAbsoluteError(mul_add[i], float_one[i] + float_two[i] * float_one[i], EPSILON);
+    expectWithinAbsoluteError(mul_sub[i], float_one[i] - float_two[i] * float_one[i], EPSILON);
+    expect(max[i] == std::max(float_one[i], float_two[i]));
+    expect(min[i] == std::min(float_one[i], float_two[i]));
+    expect(abs[i] == std::abs(float_one[i]));
+    expect(greater[i] == (float_one[i] > float_two[i] ? vital::poly_mask::kFullMask : 0));
+    expect(not_equal[i] == (float_one[i] != float_two[i] ? vital::poly_mask::kFullMask : 0));
+    total += float_one[i];
+  }
+  expect(one.sum() == total);
+
+  vital::poly_float stereo(1.0f, -1.0f);
+  for (int i = 0; i < kSize; ++i)
+    expect(stereo[i] == (i % 2 ? -1.0f : 1.0f));
+
+  beginTest("Backend Ints");
+  vital::poly_int int_first = vital::poly_int::load(int_one);
+  vital::poly_int int_second = vital::poly_int::load(int_two);
+  vital::poly_int int_add = int_first + int_second;
+  vital::poly_int int_multiply = int_first * int_second;
+  vital::poly_int int_max = vital::poly_int::max(int_first, int_second);
+  vital::poly_int int_min = vital::poly_int::min(int_first, int_second);
+  vital::poly_mask int_greater = vital::poly_int::greaterThan(int_first, int_second);
+  uint32_t int_total = 0;
+  for (int i = 0; i < kSize; ++i) {
+    expect(int_add[i] == int_one[i] + int_two[i]);
+    expect(int_multiply[i] == int_one[i] * int_two[i]);
+    // Matches the SSE2 path: max compares unsigned, min compares signed.
+    expect(int_max[i] == std::max(int_one[i], int_two[i]));
+    expect(int_min[i] == (uint32_t)std::min((int32_t)int_one[i], (int32_t)int_two[i]));
+    expect(int_greater[i] == (int_one[i] > int_two[i] ? vital::poly_mask::kFullMask : 0));
+    int_total += int_one[i];
+  }
+  expect(int_first.sum() == int_total);
+
+  beginTest("Backend Transpose");
+  float rows[4][kSize];
+  for (int r = 0; r < 4; ++r) {
+    for (int i = 0; i < kSize; ++i)
+      rows[r][i] = 100.0f * r + i;
+  }
+  vital::poly_float row0 = vital::poly_float::load(rows[0]);
+  vital::poly_float row1 = vital::poly_float::load(rows[1]);
+  vital::poly_float row2 = vital::poly_float::load(rows[2]);
+  vital::poly_float row3 = vital::poly_float::load(rows[3]);
+  vital::poly_float::transpose(row0.value, row1.value, row2.value, row3.value);
+  vital::poly_float transposed[] = { row0, row1, row2, row3 };
+  for (int r = 0; r < 4; ++r) {
+    for (int i = 0; i < kSize; ++i) {
+      int group = i - i % 4;
+      expect(transposed[r][i] == rows[i % 4][group + r]);
+    }
+  }
+}
+
 static PolyValuesTest poly_values_test;
@@ -24,5 +24,6 @@ class PolyValuesTest : public UnitTest {
     void runTest() override;
     void runFloatTests();
     void runIntTests();
+    void runBackendTests();
 };
 
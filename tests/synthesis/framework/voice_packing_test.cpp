@@ -0,0 +1,100 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "voice_packing_test.h"
+#include "sound_engine.h"
+#include "synth_oscillator.h"
+#include "wave_frame.h"
+#include "wavetable.h"
+
+namespace {
+  constexpr int kBlockSize = 64;
+  constexpr int kNumBlocks = 400;
+  constexpr int kReleaseBlock = 200;
+  constexpr float kMaxError = 0.00001f;
+  const int kNotes[] = { 48, 52, 55, 59, 62, 67 };
+  constexpr int kNumNotes = sizeof(kNotes) / sizeof(int);
+
+  void setUpEngine(vital::SoundEngine* engine, float spectral_morph) {
+    vital::WaveFrame saw;
+    for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i)
+      saw.time_domain[i] = 2.0f * i / vital::WaveFrame::kWaveformSize - 1.0f;
+    saw.toFrequencyDomain();
+    engine->getWavetable(0)->loadWaveFrame(&saw);
+
+    vital::control_map controls = engine->getControls();
+    controls["osc_1_on"]->set(1.0f);
+    controls["osc_1_random_phase"]->set(0.0f);
+    controls["osc_1_unison_voices"]->set(3.0f);
+    controls["osc_1_spectral_morph_type"]->set(spectral_morph);
+    controls["filter_1_on"]->set(1.0f);
+  }
+} // namespace
+
+std::vector<vital::poly_float> VoicePackingTest::render(float spectral_morph, int only_note) {
+  vital::SoundEngine engine;
+  setUpEngine(&engine, spectral_morph);
+
+  std::vector<vital::poly_float> result;
+  for (int b = 0; b < kNumBlocks; ++b) {
+    for (int n = 0; n < kNumNotes; ++n) {
+      if (only_note >= 0 && only_note != n)
+        continue;
+
+      // Stagger the notes so voices start and stop partway through different blocks.
+      if (b == n)
+        engine.noteOn(kNotes[n], 0.2f, (n * 23) % kBlockSize, 0);
+      else if (b == kReleaseBlock + 10 * n)
+        engine.noteOff(kNotes[n], 0.5f, (n * 7) % kBlockSize, 0);
+    }
+
+    engine.process(kBlockSize);
+    const vital::poly_float* output = engine.output()->buffer;
+    result.insert(result.end(), output, output + kBlockSize);
+  }
+  return result;
+}
+
+void VoicePackingTest::testChordMatchesSummedNotes(const String& name, float spectral_morph) {
+  beginTest("Chord Matches Summed Notes " + name);
+
+  std::vector<vital::poly_float> chord = render(spectral_morph, -1);
+  std::vector<vital::poly_float> summed(chord.size(), 0.0f);
+  for (int n = 0; n < kNumNotes; ++n) {
+    std::vector<vital::poly_float> note = render(spectral_morph, n);
+    for (size_t i = 0; i < summed.size(); ++i)
+      summed[i] += note[i];
+  }
+
+  float peak = 0.0f;
+  for (size_t i = 0; i < chord.size(); ++i) {
+    peak = std::max(peak, std::abs(chord[i][0]));
+    for (int c = 0; c < 2; ++c) {
+      float error = chord[i][c] - summed[i][c];
+      expect(error < kMaxError && -error < kMaxError, "Voice packing changed the render.");
+    }
+  }
+  expect(peak > 0.1f, "Render was silent.");
+}
+
+void VoicePackingTest::runTest() {
+  // Every voice renders on its own, so a chord should match its notes rendered separately and summed however
+  // the backend packs voices into vectors. The chord spans more than one vector on every backend.
+  testChordMatchesSummedNotes("Wavetable", vital::SynthOscillator::kNoSpectralMorph);
+  testChordMatchesSummedNotes("Spectral Morph", vital::SynthOscillator::kLowPass);
+}
+
+static VoicePackingTest voice_packing_test;
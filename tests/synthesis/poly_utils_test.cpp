@@ -19,6 +19,11 @@
 
 #define EPSILON 0.0000001f
 
+namespace {
+  // Voice shuffles work within groups of four lanes, two stereo voices each.
+  constexpr int kGroupSize = 4;
+} // namespace
+
 void PolyUtilsTest::runTest() {
   beginTest("Swap Stereo");
   vital::poly_float val;
@@ -35,15 +40,32 @@ void PolyUtilsTest::runTest() {
 
   beginTest("Swap Voices");
   vital::poly_float swap_voices = vital::utils::swapVoices(test_value);
-  for (int i = 0; i < vital::poly_float::kSize / 2; ++i) {
-    expect(swap_voices[i] == i + vital::poly_float::kSize / 2);
-    expect(swap_voices[i + vital::poly_float::kSize / 2] == i);
+  for (int g = 0; g < vital::poly_float::kSize; g += kGroupSize) {
+    for (int i = 0; i < kGroupSize / 2; ++i) {
+      expect(swap_voices[g + i] == g + i + kGroupSize / 2);
+      expect(swap_voices[g + i + kGroupSize / 2] == g + i);
+    }
   }
 
   beginTest("Reverse");
   vital::poly_float reverse = vital::utils::reverse(test_value);
-  for (int i = 0; i < vital::poly_float::kSize; ++i)
-    expect(reverse[i] == vital::poly_float::kSize - 1 - i);
+  for (int g = 0; g < vital::poly_float::kSize; g += kGroupSize) {
+    for (int i = 0; i < kGroupSize; ++i)
+      expect(reverse[g + i] == g + kGroupSize - 1 - i);
+  }
+
+  beginTest("Sum Voices");
+  vital::poly_float sum_voices = vital::utils::sumVoices(test_value);
+  vital::poly_float broadcast = vital::utils::broadcastFirstVoice(test_value);
+  for (int i = 0; i < vital::poly_float::kSize; i += 2) {
+    float left_total = 0.0f;
+    for (int v = 0; v < vital::poly_float::kSize; v += 2)
+      left_total += v;
+    expect(sum_voices[i] == left_total);
+    expect(sum_voices[i + 1] == left_total + vital::poly_float::kSize / 2);
+    expect(broadcast[i] == 0.0f);
+    expect(broadcast[i + 1] == 1.0f);
+  }
 
   beginTest("Mid Side Encoding");
   vital::poly_float encode_mid_side = vital::utils::encodeMidSide(test_value);